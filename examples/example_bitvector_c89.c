@@ -0,0 +1,89 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+/* 1.1 Optional: Define custom implementations of c4c macros. */
+/* 1.2 Optional: Enable/Disable/Change certain features by defining C4C_FEATURE macros. */
+
+/* 2. Declare the container interface in a .h file. */
+#define C4C_PARAM_STRUCT_NAME		BitVector
+#define C4C_PARAM_PREFIX			bvec
+#define C4C_PARAM_OPT_RANK_SELECT	1
+#include "c4c/vector/bitvector_decl.inl"
+
+/* 3. Declare the container implementation in a .c file or wherever you
+ *    want it to be in. Make sure the macro params for the implementation have the
+ *    same values as the interface ones.
+ */
+#define C4C_PARAM_STRUCT_NAME		BitVector
+#define C4C_PARAM_PREFIX			bvec
+#define C4C_PARAM_OPT_RANK_SELECT	1
+#include "c4c/vector/bitvector_impl.inl"
+
+/* 4. Magic happens. You can now use the container for your type :) */
+int main(int argc, char* argv[])
+{
+	/* variables */
+	size_t i;
+	c4c_res_t res;
+	BitVector premium;
+	BitVector active;
+
+	printf("C4C %s | examples/example_bitvector_c89.c\n", _C4C_VERSION_STR);
+
+	/* one bit per user */
+	if (!c4c_succeeded(res = bvec_init(&premium, 1000)) ||
+		!c4c_succeeded(res = bvec_init(&active, 1000))) {
+		printf("couldn't init bit vectors (%d)\n", res);
+		return EXIT_FAILURE;
+	}
+
+	for (i = 0; i < 1000; i++) {
+		bvec_push_back(&premium, i % 7 == 0);
+		bvec_push_back(&active, i % 2 == 0);
+	}
+
+	/* premium users that are also active */
+	bvec_bit_and(&premium, &active);
+	printf("%d active premium users\n", (int)bvec_count(&premium));
+
+	/* position of the 10th one and how many come before user 500 */
+	bvec_build_rank(&premium);
+	printf("10th: user %d, before user 500: %d\n", (int)bvec_select(&premium, 9),
+		(int)bvec_rank(&premium, 500));
+
+	bvec_free(&premium);
+	bvec_free(&active);
+
+	getchar();
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,102 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+typedef struct Result {
+	int job;
+	double score;
+} Result;
+
+/* 1.1 Optional: Define custom implementations of c4c macros. */
+/* 1.2 Optional: Enable/Disable/Change certain features by defining C4C_FEATURE macros. */
+
+/* 2. Declare the container interface in a .h file. */
+#define C4C_PARAM_STRUCT_NAME		ConcurrentVector
+#define C4C_PARAM_PREFIX			cvec
+#define C4C_PARAM_CONTENT_TYPE		Result
+#include "c4c/vector/concurrent_vector_decl.inl"
+
+/* 3. Declare the container implementation in a .c file or wherever you
+ *    want it to be in. Make sure the macro params for the implementation have the
+ *    same values as the interface ones.
+ */
+#define C4C_PARAM_STRUCT_NAME		ConcurrentVector
+#define C4C_PARAM_PREFIX			cvec
+#define C4C_PARAM_CONTENT_TYPE		Result
+#include "c4c/vector/concurrent_vector_impl.inl"
+
+/* Called by every worker thread, no lock needed. */
+static void store_result(ConcurrentVector* results, int job)
+{
+	size_t index;
+	Result* slot = cvec_emplace_back(results, &index);
+	if (!slot)
+		return;
+	slot->job = job;
+	slot->score = job * 0.25;
+	cvec_publish(results, index);
+}
+
+/* 4. Magic happens. You can now use the container for your type :) */
+int main(int argc, char* argv[])
+{
+	/* variables */
+	int i;
+	size_t j, published = 0;
+	ConcurrentVector results;
+	Result* result;
+
+	printf("C4C %s | examples/example_concurrent_vector_c89.c\n", _C4C_VERSION_STR);
+
+	cvec_init(&results);
+
+	/* pre-allocate so that the workers never have to */
+	cvec_reserve(&results, 5000);
+
+	/* spawn workers here, they all call store_result() */
+	for (i = 0; i < 5000; i++) {
+		store_result(&results, i);
+	}
+
+	/* a consumer can scan at any time, unpublished slots are skipped */
+	for (j = 0; j < cvec_size(&results); j++) {
+		if ((result = cvec_at(&results, j)) != NULL)
+			++published;
+	}
+
+	printf("%d results published\n", (int)published);
+
+	cvec_free(&results);
+
+	getchar();
+	return EXIT_SUCCESS;
+}
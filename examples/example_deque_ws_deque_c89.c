@@ -0,0 +1,96 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+/* 1.1 Optional: Define custom implementations of c4c macros. */
+/* 1.2 Optional: Enable/Disable/Change certain features by defining C4C_FEATURE macros. */
+
+typedef struct {
+	int id;
+} Task;
+
+/* 2. Declare the container interface in a .h file. */
+#define C4C_PARAM_STRUCT_NAME	TaskQueue
+#define C4C_PARAM_PREFIX		task_queue
+#define C4C_PARAM_CONTENT_TYPE	Task*
+#include "c4c/deque/ws_deque_decl.inl"
+
+/* 3. Declare the container implementation in a .c file or wherever you
+ *    want it to be in. Make sure the macro params for the implementation have the
+ *    same values as the interface ones.
+ */
+#define C4C_PARAM_STRUCT_NAME	TaskQueue
+#define C4C_PARAM_PREFIX		task_queue
+#define C4C_PARAM_CONTENT_TYPE	Task*
+#include "c4c/deque/ws_deque_impl.inl"
+
+/* 4. Magic happens. You can now use the container for your type :) */
+int main(int argc, char* argv[])
+{
+	/* variables */
+	int i;
+	Task tasks[32];
+	Task* task;
+	TaskQueue queue;
+
+	printf("C4C %s | examples/example_deque_ws_deque_c89.c\n", _C4C_VERSION_STR);
+
+	/* one deque per worker thread, it grows past 8 on demand */
+	if (!c4c_succeeded(task_queue_init(&queue, 8))) {
+		printf("failed to initialize the deque\n");
+		return EXIT_FAILURE;
+	}
+
+	/* the owner (worker) pushes the tasks it spawns */
+	for (i = 0; i < 32; i++) {
+		tasks[i].id = i;
+		if (!c4c_succeeded(task_queue_push(&queue, &tasks[i]))) {
+			printf("out of memory\n");
+			task_queue_free(&queue);
+			return EXIT_FAILURE;
+		}
+	}
+
+	/* idle workers steal the oldest tasks from the top... */
+	if (task_queue_steal(&queue, &task) == C4CE_SUCCESS)
+		printf("stolen task %d\n", task->id);
+
+	/* ...while the owner keeps working on the newest ones */
+	while (task_queue_pop(&queue, &task) == C4CE_SUCCESS)
+		printf("task %d ", task->id);
+	printf("\nsize: %d\n", (int)task_queue_size(&queue));
+
+	task_queue_free(&queue);
+
+	getchar();
+	return EXIT_SUCCESS;
+}
@@ -85,6 +85,14 @@ int main(int argc, char* argv[])
 		printf("my_list (a: %d, b: %d)\n", iter->a, iter->b);
 	}
 
+	/* add t2 back, this time at the end of the list, and walk it backwards */
+	my_list_add_tail(&head, &t2);
+
+	printf("\n");
+	c4c_list_foreach_backward(&head, iter) {
+		printf("my_list (a: %d, b: %d)\n", iter->a, iter->b);
+	}
+
 	getchar();
 	return EXIT_SUCCESS;
 }
@@ -46,6 +46,13 @@ rettype __stdcall name(__VA_ARGS__)
 /* 1.3 Optional: Make the container static by defining C4C_ALLOC_STATIC
  */
 
+/* 1.4 Optional: Make appends amortized O(1) by choosing a multiplicative growth
+ *     policy (must be defined for both the interface and the implementation).
+ */
+/*
+#define C4C_PARAM_OPT_GROWTH	C4C_GROWTH_2X
+*/
+
 /* 2. Declare the container interface in a .h file. */
 #define C4C_PARAM_STRUCT_NAME	TestVector
 #define C4C_PARAM_PREFIX		tvec
@@ -88,15 +95,15 @@ int main(int argc, char* argv[])
 
 	dump_vec(&vec);
 
-	/* since the vector's allocated slots have been filled, grow the vector by 
-	 * the number of elements specified in the optional header param 
-	 * C4C_PARAM_OPT_ALLOC_BLOCK (default is set to 4 so allocate 4 new slots).
+	/* since the vector's allocated slots have been filled, grow the vector 
+	 * following the optional header param C4C_PARAM_OPT_GROWTH (default is 
+	 * C4C_GROWTH_LINEAR so allocate C4C_ALLOC_DYNAMIC new slots).
 	 */
 	if (!c4c_succeeded(res = tvec_push_back(&vec, (int)100))) {
 		printf("couldn't add element (%d)\n", res);
 	}
 
-	/* If C4C_PARAM_OPT_ALLOC_BLOCK > 1 this won't allocate */
+	/* If the growth policy allocated more than one slot this won't allocate */
 	if (!c4c_succeeded(res = tvec_push_back(&vec, (int)101))) {
 		printf("couldn't add element (%d)\n", res);
 	}
@@ -0,0 +1,125 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+/* The element type: the key is extracted by the KEY_OF param. */
+typedef struct Pair {
+	int key;
+	double value;
+} Pair;
+
+#define PAIR_KEY(pair) ((pair).key)
+
+/* 1.1 Optional: Define custom implementations of c4c macros. */
+/* 1.2 Optional: Enable/Disable/Change certain features by defining C4C_FEATURE macros. */
+
+/* 2. Declare the container interface in a .h file. */
+#define C4C_PARAM_STRUCT_NAME		FlatMap
+#define C4C_PARAM_PREFIX			fmap
+#define C4C_PARAM_CONTENT_TYPE		Pair
+#define C4C_PARAM_KEY_TYPE			int
+#define C4C_PARAM_OPT_KEY_OF		PAIR_KEY
+#define C4C_PARAM_OPT_EYTZINGER		1
+#include "c4c/flat_map/flat_map_decl.inl"
+
+/* 3. Declare the container implementation in a .c file or wherever you
+ *    want it to be in. Make sure the macro params for the implementation have the
+ *    same values as the interface ones.
+ */
+#define C4C_PARAM_STRUCT_NAME		FlatMap
+#define C4C_PARAM_PREFIX			fmap
+#define C4C_PARAM_CONTENT_TYPE		Pair
+#define C4C_PARAM_KEY_TYPE			int
+#define C4C_PARAM_OPT_KEY_OF		PAIR_KEY
+#define C4C_PARAM_OPT_EYTZINGER		1
+#include "c4c/flat_map/flat_map_impl.inl"
+
+void dump_map(const FlatMap* map);
+
+/* 4. Magic happens. You can now use the container for your type :) */
+int main(int argc, char* argv[])
+{
+	/* variables */
+	int i;
+	c4c_res_t res;
+	FlatMap map;
+	Pair pair;
+	Pair* found;
+
+	printf("C4C %s | examples/example_flat_map_c89.c\n", _C4C_VERSION_STR);
+
+	if (!c4c_succeeded(res = fmap_init(&map, 16))) {
+		printf("couldn't init map (%d)\n", res);
+		return EXIT_FAILURE;
+	}
+
+	/* batch construction: push in any order then sort once */
+	for (i = 0; i < 10; i++) {
+		pair.key = (i * 7) % 10;
+		pair.value = pair.key * 1.5;
+		fmap_push_unsorted(&map, pair);
+	}
+	fmap_build(&map);
+
+	dump_map(&map);
+
+	/* occasional ordered insertion and deletion */
+	pair.key = 42;
+	pair.value = 0.5;
+	fmap_insert(&map, pair);
+	fmap_erase(&map, 3);
+
+	dump_map(&map);
+
+	/* the Eytzinger layout is rebuilt explicitly after a batch of updates */
+	fmap_build(&map);
+
+	found = fmap_find(&map, 42);
+	if (found) {
+		printf("\nfound key 42: %.2f\n", found->value);
+	}
+	printf("contains key 3: %d\n", fmap_contains(&map, 3));
+
+	fmap_free(&map);
+
+	getchar();
+	return EXIT_SUCCESS;
+}
+
+void dump_map(const FlatMap* map)
+{
+	size_t i;
+	printf("\nmap: %d/%d\n", (int)map->size, (int)map->capacity);
+	for (i = 0; i < map->size; i++) {
+		printf("[%.2d] %d -> %.2f\n", (int)i, map->data[i].key, map->data[i].value);
+	}
+}
@@ -0,0 +1,102 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+/* 1.1 Optional: Define custom implementations of c4c macros. */
+/* 1.2 Optional: Enable/Disable/Change certain features by defining C4C_FEATURE macros. */
+
+/* 2. Declare the container interface in a .h file. */
+#define C4C_PARAM_STRUCT_NAME	Conn
+#define C4C_PARAM_PREFIX		conn_list
+#define C4C_PARAM_CONTENT		unsigned port;
+#include "c4c/linked_list/hlist_decl.inl"
+
+/* 3. Declare the container implementation in a .c file or wherever you
+ *    want it to be in. Make sure the macro params for the implementation have the
+ *    same values as the interface ones.
+ */
+#define C4C_PARAM_STRUCT_NAME	Conn
+#define C4C_PARAM_PREFIX		conn_list
+#define C4C_PARAM_CONTENT		unsigned port;
+#include "c4c/linked_list/hlist_impl.inl"
+
+#define BUCKETS 8
+
+/* 4. Magic happens. You can now use the container for your type :) */
+int main(int argc, char* argv[])
+{
+	/* variables */
+	int i;
+	Conn conns[20];
+	Conn* iter;
+	Conn* tmp;
+	Conn_head table[BUCKETS]; /* one pointer per bucket */
+
+	printf("C4C %s | examples/example_hlist_c89.c\n", _C4C_VERSION_STR);
+
+	for (i = 0; i < BUCKETS; i++)
+		conn_list_init(&table[i]);
+
+	/* hash the connections by port */
+	for (i = 0; i < 20; i++) {
+		conns[i].port = 8000 + i * 3;
+		conn_list_add_head(&table[conns[i].port % BUCKETS], &conns[i]);
+	}
+
+	/* lookup */
+	c4c_hlist_foreach(&table[8030 % BUCKETS], iter) {
+		if (iter->port == 8030)
+			printf("found port %u\n", iter->port);
+	}
+
+	/* nodes can be removed without knowing their bucket */
+	conn_list_delete(&conns[10]);
+	printf("unhashed: %d\n", c4c_hlist_is_unhashed(&conns[10]));
+
+	/* drop the even ports while iterating */
+	for (i = 0; i < BUCKETS; i++) {
+		c4c_hlist_foreach_safe(&table[i], iter, tmp) {
+			if (iter->port % 2 == 0)
+				conn_list_delete(iter);
+		}
+	}
+
+	for (i = 0; i < BUCKETS; i++) {
+		printf("bucket %d:", i);
+		c4c_hlist_foreach(&table[i], iter)
+			printf(" %u", iter->port);
+		printf("\n");
+	}
+
+	getchar();
+	return EXIT_SUCCESS;
+}
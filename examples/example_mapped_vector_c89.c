@@ -0,0 +1,114 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/* 0. POSIX only: ftruncate() needs POSIX.1-2001, request it before any
+ *    system header (strict -std=c89/c99 modes hide it otherwise).
+ */
+#ifndef _POSIX_C_SOURCE
+#  define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+/* Persisted elements must not contain pointers. */
+typedef struct Sample {
+	int id;
+	float value;
+} Sample;
+
+/* 1.1 Optional: Define custom implementations of c4c macros. */
+/* 1.2 Optional: Enable/Disable/Change certain features by defining C4C_FEATURE macros. */
+
+/* 2. Declare the container interface in a .h file. */
+#define C4C_PARAM_STRUCT_NAME		MappedVector
+#define C4C_PARAM_PREFIX			mvec
+#define C4C_PARAM_CONTENT_TYPE		Sample
+#include "c4c/vector/mapped_vector_decl.inl"
+
+/* 3. Declare the container implementation in a .c file or wherever you
+ *    want it to be in. Make sure the macro params for the implementation have the
+ *    same values as the interface ones.
+ */
+#define C4C_PARAM_STRUCT_NAME		MappedVector
+#define C4C_PARAM_PREFIX			mvec
+#define C4C_PARAM_CONTENT_TYPE		Sample
+#include "c4c/vector/mapped_vector_impl.inl"
+
+/* 4. Magic happens. You can now use the container for your type :) */
+int main(int argc, char* argv[])
+{
+	/* variables */
+	int i;
+	c4c_res_t res;
+	MappedVector vec;
+	Sample sample;
+
+	printf("C4C %s | examples/example_mapped_vector_c89.c\n", _C4C_VERSION_STR);
+
+	/* the file is created if missing... */
+	if (!c4c_succeeded(res = mvec_open(&vec, "samples.c4c", 64))) {
+		printf("couldn't open samples.c4c (%d)\n", res);
+		return EXIT_FAILURE;
+	}
+
+	for (i = 0; i < 10; i++) {
+		sample.id = (int)vec.size;
+		sample.value = (float)vec.size * 0.5f;
+		if (!c4c_succeeded(res = mvec_push_back(&vec, sample))) {
+			printf("couldn't add sample (%d)\n", res);
+		}
+	}
+
+	/* wait for everything to be on disk then release the file */
+	mvec_sync(&vec);
+	mvec_close(&vec);
+
+	/* ...and mapped back as is when it exists */
+	if (!c4c_succeeded(res = mvec_open(&vec, "samples.c4c", 64))) {
+		printf("couldn't reopen samples.c4c (%d)\n", res);
+		remove("samples.c4c");
+		return EXIT_FAILURE;
+	}
+
+	printf("loaded %d samples\n", (int)vec.size);
+	if (vec.size > 0) {
+		printf("last sample: %d -> %.2f\n", vec.data[vec.size - 1].id,
+			vec.data[vec.size - 1].value);
+	}
+
+	mvec_close(&vec);
+
+	/* don't leave the example's file behind */
+	remove("samples.c4c");
+
+	getchar();
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,98 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+typedef struct Particle {
+	float x, y;
+} Particle;
+
+/* 1.1 Optional: Define custom implementations of c4c macros. */
+/* 1.2 Optional: Enable/Disable/Change certain features by defining C4C_FEATURE macros. */
+
+/* 2. Declare the container interface in a .h file. */
+#define C4C_PARAM_STRUCT_NAME		SegmentedVector
+#define C4C_PARAM_PREFIX			svec
+#define C4C_PARAM_CONTENT_TYPE		Particle
+#define C4C_PARAM_OPT_CHUNK_SHIFT	6
+#include "c4c/vector/segmented_vector_decl.inl"
+
+/* 3. Declare the container implementation in a .c file or wherever you
+ *    want it to be in. Make sure the macro params for the implementation have the
+ *    same values as the interface ones.
+ */
+#define C4C_PARAM_STRUCT_NAME		SegmentedVector
+#define C4C_PARAM_PREFIX			svec
+#define C4C_PARAM_CONTENT_TYPE		Particle
+#define C4C_PARAM_OPT_CHUNK_SHIFT	6
+#include "c4c/vector/segmented_vector_impl.inl"
+
+/* 4. Magic happens. You can now use the container for your type :) */
+int main(int argc, char* argv[])
+{
+	/* variables */
+	int i;
+	c4c_res_t res;
+	SegmentedVector vec;
+	Particle particle;
+	Particle* first;
+
+	printf("C4C %s | examples/example_segmented_vector_c89.c\n", _C4C_VERSION_STR);
+
+	if (!c4c_succeeded(res = svec_init(&vec, 0))) {
+		printf("couldn't init vector (%d)\n", res);
+		return EXIT_FAILURE;
+	}
+
+	particle.x = 0.0f;
+	particle.y = 0.0f;
+	svec_push_back(&vec, particle);
+
+	/* pointers to elements stay valid while the vector grows */
+	first = svec_at(&vec, 0);
+
+	for (i = 1; i < 1000; i++) {
+		particle.x = (float)i;
+		particle.y = (float)i * 2.0f;
+		if (!c4c_succeeded(res = svec_push_back(&vec, particle))) {
+			printf("couldn't add particle (%d)\n", res);
+		}
+	}
+
+	assert(first == svec_at(&vec, 0));
+	printf("%d particles in %d chunks, last one: (%.1f, %.1f)\n", (int)vec.size,
+		(int)vec.chunks_count, svec_at(&vec, 999)->x, svec_at(&vec, 999)->y);
+
+	svec_free(&vec);
+
+	getchar();
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,106 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+/* 1.1 Optional: Define custom implementations of c4c macros. */
+/* 1.2 Optional: Enable/Disable/Change certain features by defining C4C_FEATURE macros. */
+
+/* 2. Declare the container interface in a .h file. */
+#define C4C_PARAM_STRUCT_NAME		SmallVector
+#define C4C_PARAM_PREFIX			svec
+#define C4C_PARAM_CONTENT_TYPE		int
+#define C4C_PARAM_INLINE_CAPACITY	8
+#define C4C_PARAM_OPT_GROWTH		C4C_GROWTH_2X
+#include "c4c/vector/small_vector_decl.inl"
+
+/* 3. Declare the container implementation in a .c file or wherever you
+ *    want it to be in. Make sure the macro params for the implementation have the
+ *    same values as the interface ones.
+ */
+#define C4C_PARAM_STRUCT_NAME		SmallVector
+#define C4C_PARAM_PREFIX			svec
+#define C4C_PARAM_CONTENT_TYPE		int
+#define C4C_PARAM_INLINE_CAPACITY	8
+#define C4C_PARAM_OPT_GROWTH		C4C_GROWTH_2X
+#include "c4c/vector/small_vector_impl.inl"
+
+void dump_vec(const SmallVector* vec);
+
+/* 4. Magic happens. You can now use the container for your type :) */
+int main(int argc, char* argv[])
+{
+	/* variables */
+	int i;
+	c4c_res_t res;
+	SmallVector vec;
+
+	printf("C4C %s | examples/example_small_vector_c89.c\n", _C4C_VERSION_STR);
+
+	/* init the vector: no allocation is performed for up to 8 elements */
+	svec_init(&vec, 0);
+
+	for (i = 0; i < 8; i++) {
+		svec_push_back(&vec, i);
+	}
+
+	dump_vec(&vec);
+
+	/* the 9th element doesn't fit inside the struct anymore: spill to the heap */
+	if (!c4c_succeeded(res = svec_push_back(&vec, 8))) {
+		printf("couldn't add element (%d)\n", res);
+	}
+
+	dump_vec(&vec);
+
+	/* remove most of the elements (keeping their order) and move the 
+	 * remaining ones back inside the struct.
+	 */
+	svec_erase_range(&vec, 2, vec.size);
+	svec_shrink_to_fit(&vec);
+
+	dump_vec(&vec);
+
+	svec_free(&vec);
+
+	getchar();
+	return EXIT_SUCCESS;
+}
+
+void dump_vec(const SmallVector* vec)
+{
+	size_t i;
+	printf("\nvec: %d/%d (%s)\n", (int)vec->size, (int)vec->capacity,
+		svec_is_inline(vec) ? "inline" : "heap");
+	for (i = 0; i < vec->size; i++) {
+		printf("[%.2d] %d\n", (int)i, vec->data[i]);
+	}
+}
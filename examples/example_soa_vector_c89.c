@@ -0,0 +1,113 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+/* 1.1 Optional: Define custom implementations of c4c macros. */
+/* 1.2 Optional: Enable/Disable/Change certain features by defining C4C_FEATURE macros. */
+
+/* The element's fields: every one of them gets its own array. */
+#define PARTICLE_FIELDS(X) \
+	X(float, x) \
+	X(float, y) \
+	X(float, mass) \
+	X(int, id)
+
+/* 2. Declare the container interface in a .h file. */
+#define C4C_PARAM_STRUCT_NAME		Particles
+#define C4C_PARAM_PREFIX			particles
+#define C4C_PARAM_FIELDS			PARTICLE_FIELDS
+#define C4C_PARAM_OPT_GROWTH		C4C_GROWTH_2X
+#include "c4c/vector/soa_vector_decl.inl"
+
+/* 3. Declare the container implementation in a .c file or wherever you
+ *    want it to be in. Make sure the macro params for the implementation have the
+ *    same values as the interface ones.
+ */
+#define C4C_PARAM_STRUCT_NAME		Particles
+#define C4C_PARAM_PREFIX			particles
+#define C4C_PARAM_FIELDS			PARTICLE_FIELDS
+#define C4C_PARAM_OPT_GROWTH		C4C_GROWTH_2X
+#include "c4c/vector/soa_vector_impl.inl"
+
+float total_mass(const float* mass, size_t n);
+
+/* 4. Magic happens. You can now use the container for your type :) */
+int main(int argc, char* argv[])
+{
+	/* variables */
+	int i;
+	size_t j;
+	c4c_res_t res;
+	Particles vec;
+
+	printf("C4C %s | examples/example_soa_vector_c89.c\n", _C4C_VERSION_STR);
+
+	if (!c4c_succeeded(res = particles_init(&vec, 4))) {
+		printf("couldn't init vector (%d)\n", res);
+		return EXIT_FAILURE;
+	}
+
+	/* one argument per field, in declaration order */
+	for (i = 0; i < 10; i++) {
+		particles_push_back(&vec, (float)i, (float)(i * i), 0.5f + i, i);
+	}
+
+	/* loops touching a single field only read that field's array */
+	for (j = 0; j < vec.size; j++) {
+		vec.x[j] += 1.0f;
+	}
+
+	/* a whole column can be handed to other functions */
+	printf("total mass: %.2f\n", total_mass(particles_mass(&vec), vec.size));
+
+	/* remove the first particle: the last one takes its place */
+	particles_pop_at(&vec, 0);
+
+	for (j = 0; j < vec.size; j++) {
+		printf("[%.2d] id: %d (%.2f, %.2f)\n", (int)j, vec.id[j], vec.x[j], vec.y[j]);
+	}
+
+	particles_free(&vec);
+
+	getchar();
+	return EXIT_SUCCESS;
+}
+
+float total_mass(const float* mass, size_t n)
+{
+	size_t i;
+	float total = 0.0f;
+	for (i = 0; i < n; i++) {
+		total += mass[i];
+	}
+	return total;
+}
@@ -0,0 +1,90 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+/* 1.1 Optional: Define custom implementations of c4c macros. */
+/* 1.2 Optional: Enable/Disable/Change certain features by defining C4C_FEATURE macros. */
+
+/* 2. Declare the container interface in a .h file. */
+#define C4C_PARAM_STRUCT_NAME	DynStack
+#define C4C_PARAM_PREFIX		dyn_stack
+#define C4C_PARAM_CONTENT_TYPE	int
+#define C4C_PARAM_OPT_NO_VALUE	-1
+#include "c4c/stack/dynamic_lifo_decl.inl"
+
+/* 3. Declare the container implementation in a .c file or wherever you
+ *    want it to be in. Make sure the macro params for the implementation have the
+ *    same values as the interface ones.
+ */
+#define C4C_PARAM_STRUCT_NAME	DynStack
+#define C4C_PARAM_PREFIX		dyn_stack
+#define C4C_PARAM_CONTENT_TYPE	int
+#define C4C_PARAM_OPT_NO_VALUE	-1
+#include "c4c/stack/dynamic_lifo_impl.inl"
+
+/* 4. Magic happens. You can now use the container for your type :) */
+int main(int argc, char* argv[])
+{
+	/* variables */
+	int node;
+	int visited = 0;
+	c4c_res_t res;
+	DynStack stack;
+
+	printf("C4C %s | examples/example_stack_dynamic_lifo_c89.c\n", _C4C_VERSION_STR);
+
+	/* start small, the stack grows as deep as needed */
+	if (!c4c_succeeded(res = dyn_stack_init(&stack, 16))) {
+		printf("couldn't init stack (%d)\n", res);
+		return EXIT_FAILURE;
+	}
+
+	/* depth first visit of a complete binary tree with 2^16 - 1 nodes */
+	dyn_stack_push(&stack, 1);
+	while ((node = dyn_stack_pop(&stack)) != dyn_stack_null_val()) {
+		++visited;
+		if (node < (1 << 15)) {
+			if (!c4c_succeeded(res = dyn_stack_push(&stack, node * 2 + 1)) ||
+				!c4c_succeeded(res = dyn_stack_push(&stack, node * 2))) {
+				printf("couldn't push node (%d)\n", res);
+				break;
+			}
+		}
+	}
+
+	printf("visited %d nodes, capacity is back to %d\n", visited, (int)stack.capacity);
+
+	dyn_stack_free(&stack);
+
+	getchar();
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,85 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+/* 1.1 Optional: Define custom implementations of c4c macros. */
+/* 1.2 Optional: Enable/Disable/Change certain features by defining C4C_FEATURE macros. */
+
+/* 2. Declare the container interface in a .h file. */
+#define C4C_PARAM_STRUCT_NAME	Buffer
+#define C4C_PARAM_PREFIX		buffer_pool
+#define C4C_PARAM_CONTENT		int id; char data[256];
+#include "c4c/stack/lockfree_lifo_decl.inl"
+
+/* 3. Declare the container implementation in a .c file or wherever you
+ *    want it to be in. Make sure the macro params for the implementation have the
+ *    same values as the interface ones.
+ */
+#define C4C_PARAM_STRUCT_NAME	Buffer
+#define C4C_PARAM_PREFIX		buffer_pool
+#define C4C_PARAM_CONTENT		int id; char data[256];
+#include "c4c/stack/lockfree_lifo_impl.inl"
+
+/* 4. Magic happens. You can now use the container for your type :) */
+int main(int argc, char* argv[])
+{
+	/* variables */
+	int i;
+	int count = 0;
+	Buffer buffers[16];
+	Buffer_head pool;
+	Buffer* buffer;
+
+	printf("C4C %s | examples/example_stack_lockfree_lifo_c89.c\n", _C4C_VERSION_STR);
+
+	/* the pool can be shared by any number of threads */
+	buffer_pool_init(&pool);
+	for (i = 0; i < 16; i++) {
+		buffers[i].id = i;
+		buffer_pool_push(&pool, &buffers[i]);
+	}
+
+	/* take a buffer, use it and give it back */
+	buffer = buffer_pool_pop(&pool);
+	if (buffer) {
+		printf("got buffer %d\n", buffer->id);
+		buffer_pool_push(&pool, buffer);
+	}
+
+	/* grab everything at once, e.g. on shutdown */
+	for (buffer = buffer_pool_pop_all(&pool); buffer; buffer = buffer->next)
+		++count;
+	printf("%d buffers released, pool empty: %d\n", count, buffer_pool_is_empty(&pool));
+
+	getchar();
+	return EXIT_SUCCESS;
+}
@@ -118,6 +118,14 @@
  *   allocation call.
  * - By default these containers will have C4C_ALLOC_DYNAMIC defined with the
  *   value: 1.
+ * - Dynamic containers grow automatically following the C4C_PARAM_OPT_GROWTH
+ *   policy (see c4c/internal/params/optgrowth.h). The default policy grows by
+ *   C4C_ALLOC_DYNAMIC elements at a time, C4C_GROWTH_1_5X and C4C_GROWTH_2X
+ *   make repeated insertions amortized O(1).
+ * - Storage alignment can be raised with C4C_PARAM_OPT_ALIGNMENT (see
+ *   c4c/internal/params/optalignment.h). Aligned blocks are allocated with
+ *   C4C_ALIGNED_ALLOC/C4C_ALIGNED_FREE, which default to an implementation on
+ *   top of C4C_ALLOC/C4C_FREE.
  *
  * TODOs, FAQs, and stuff:
  * - I will add more and more containers as I need them. If you have created
@@ -182,6 +190,16 @@
  * what you may have expected (always > 1).
  */
 typedef enum {
+	/**
+	 * Another thread won the race for the same element. Retry (or move on).
+	 */
+	C4CE_CONTENDED 						= -9,
+
+	/**
+	 * A file or memory mapping operation failed (see errno or GetLastError()).
+	 */
+	C4CE_IO_FAIL 						= -8,
+
 	/**
 	 * The container is empty.
 	 */
@@ -0,0 +1,200 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/**
+ * Container:
+ * 		Work-stealing deque (Chase-Lev).
+ *
+ * Brief description:
+ * 		Deque owned by a single thread that pushes and pops at the bottom
+ * 		without locks (LIFO, cache friendly) while any number of other threads
+ * 		steal from the top (FIFO) with a compare-and-swap. Only the last
+ * 		element is contended between owner and thieves. The circular backing
+ * 		array doubles when full; the old arrays are kept until free() because a
+ * 		thief may still be reading from them.
+ *
+ * 		Based on "Dynamic Circular Work-Stealing Deque" (Chase, Lev) and the
+ * 		memory orderings of "Correct and Efficient Work-Stealing for Weak
+ * 		Memory Models" (Le, Pop, Cohen, Zappa Nardelli).
+ *
+ * Supports allocators: YES
+ * Container type:      DYNAMIC
+ *
+ * Features:
+ * - Owner push/pop: no atomic read-modify-write except for the last element.
+ * - Thieves steal with a single compare-and-swap.
+ * - Grows without bounds (capacity is always a power of two).
+ *
+ * @warning C4C_PARAM_CONTENT_TYPE is copied while other threads may be
+ *          accessing the same slot (the copy is then discarded): use small
+ *          plain types, typically pointers to the tasks.
+ */
+
+#include "c4c/internal/allocators_decl.h"
+#include "c4c/internal/common_headers.h"
+
+#ifdef C4C_ALLOC_STATIC
+#  error The work-stealing deque grows on demand: C4C_ALLOC_STATIC is not supported.
+#endif
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+/*
+Parameters:
+
+#define C4C_PARAM_STRUCT_NAME 
+#define C4C_PARAM_PREFIX 
+#define C4C_PARAM_CONTENT_TYPE 
+*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/contenttype.h"
+
+#define __C4C_WS_DEQUE_ARRAY_(name) _C4C_CONCAT(name, _array)
+#define __C4C_WS_DEQUE_ARRAY __C4C_WS_DEQUE_ARRAY_(C4C_PARAM_STRUCT_NAME)
+
+/*------------------------------------------------------------------------------
+	deque structs definition
+------------------------------------------------------------------------------*/
+
+/* Circular array, capacity is mask + 1. */
+C4C_STRUCT_BEGIN(__C4C_WS_DEQUE_ARRAY)
+	size_t mask;
+	C4C_PARAM_CONTENT_TYPE* elements;
+	struct __C4C_WS_DEQUE_ARRAY* prev;
+C4C_STRUCT_END(__C4C_WS_DEQUE_ARRAY)
+
+/*
+ * top is written by the thieves, bottom by the owner: keep them on different
+ * cache lines.
+ */
+C4C_STRUCT_BEGIN(C4C_PARAM_STRUCT_NAME)
+	volatile size_t top;
+	char top_pad[64 - sizeof(size_t)];
+	volatile size_t bottom;
+	C4C_STRUCT_DECLARE(__C4C_WS_DEQUE_ARRAY)* volatile array;
+C4C_STRUCT_END(C4C_PARAM_STRUCT_NAME)
+
+/*------------------------------------------------------------------------------
+	deque functions
+------------------------------------------------------------------------------*/
+
+/**
+ * Initialize a new work-stealing deque.
+ *
+ * @warning Not thread safe.
+ *
+ * @param deque     The deque.
+ * @param capacity  The initial capacity (rounded up to a power of two).
+ *
+ * @retval C4CE_INVALID_ARG  Capacity is zero.
+ * @retval C4CE_MALLOC_FAIL  C4C_ALLOC() failed.
+ * @retval C4CE_SUCCESS      Success.
+ */
+C4C_METHOD(c4c_res_t, init, C4C_THIS deque, size_t capacity);
+
+/**
+ * Free the deque's memory and prepare for new usage (must re-initialize
+ * first).
+ *
+ * @warning Not thread safe: every thief must be done with the deque.
+ *
+ * @param deque  The deque.
+ */
+C4C_METHOD(void, free, C4C_THIS deque);
+
+/**
+ * Insert a new element at the bottom of the deque.
+ *
+ * @note Owner thread only. If the deque is full its capacity is doubled.
+ *
+ * @param deque    The deque.
+ * @param element  The element to add.
+ *
+ * @retval C4CE_MALLOC_FAIL  The deque is full and C4C_ALLOC() failed. The
+ *                           deque is left untouched.
+ * @retval C4CE_SUCCESS      Success.
+ */
+C4C_METHOD(c4c_res_t, push, C4C_THIS deque, C4C_PARAM_CONTENT_TYPE element);
+
+/**
+ * Remove the element at the bottom of the deque (the last pushed one).
+ *
+ * @note Owner thread only.
+ *
+ * @param deque    The deque.
+ * @param element  Receives the removed element.
+ *
+ * @retval C4CE_EMPTY    The deque is empty (or a thief stole the last
+ *                       element). element is left untouched.
+ * @retval C4CE_SUCCESS  Success.
+ */
+C4C_METHOD(c4c_res_t, pop, C4C_THIS deque, C4C_PARAM_CONTENT_TYPE* element);
+
+/**
+ * Remove the element at the top of the deque (the oldest one).
+ *
+ * @note Thread safe, meant to be called by the threads not owning the deque.
+ *
+ * @param deque    The deque.
+ * @param element  Receives the removed element.
+ *
+ * @retval C4CE_EMPTY      The deque is empty. element is left untouched.
+ * @retval C4CE_CONTENDED  Another thread took the top element first. element
+ *                         is left untouched.
+ * @retval C4CE_SUCCESS    Success.
+ */
+C4C_METHOD(c4c_res_t, steal, C4C_THIS deque, C4C_PARAM_CONTENT_TYPE* element);
+
+/**
+ * Get the number of elements in the deque.
+ *
+ * @note Thread safe, but the result is only a snapshot (exact if called by
+ *       the owner with no thief around).
+ *
+ * @param deque  The deque.
+ *
+ * @return The number of elements.
+ */
+C4C_METHOD(size_t, size, const C4C_THIS deque);
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#undef __C4C_WS_DEQUE_ARRAY_
+#undef __C4C_WS_DEQUE_ARRAY
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/contenttype_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
@@ -0,0 +1,196 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include "c4c/internal/allocators_impl.h"
+#include "c4c/internal/common_headers.h"
+#include "c4c/internal/atomic.h"
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/contenttype.h"
+
+#define __C4C_WS_DEQUE_ARRAY_(name) _C4C_CONCAT(name, _array)
+#define __C4C_WS_DEQUE_ARRAY __C4C_WS_DEQUE_ARRAY_(C4C_PARAM_STRUCT_NAME)
+
+/*------------------------------------------------------------------------------
+    deque static functions
+------------------------------------------------------------------------------*/
+
+#define _ws_deque_array_t_ C4C_STRUCT_DECLARE(__C4C_WS_DEQUE_ARRAY)
+
+/* Elements count between top and bottom (0 if a pop is racing a steal). */
+#define _ws_deque_count_(top_, bottom_) \
+	((ptrdiff_t)((bottom_) - (top_)) > 0 ? (size_t)((bottom_) - (top_)) : 0)
+
+/* capacity must be a power of two. */
+C4C_METHOD_INLINE(_ws_deque_array_t_*, array_new_, size_t capacity)
+{
+	_ws_deque_array_t_* array = C4C_ALLOC(sizeof(_ws_deque_array_t_));
+	if (!array)
+		return NULL;
+	array->elements = C4C_ALLOC(sizeof(C4C_PARAM_CONTENT_TYPE) * capacity);
+	if (!array->elements) {
+		C4C_FREE(array);
+		return NULL;
+	}
+	array->mask = capacity - 1;
+	array->prev = NULL;
+	return array;
+}
+
+/*------------------------------------------------------------------------------
+    deque functions implementation
+------------------------------------------------------------------------------*/
+
+C4C_METHOD(c4c_res_t, init, C4C_THIS deque, size_t capacity)
+{
+	size_t pow2 = 1;
+	deque->top = 0;
+	deque->bottom = 0;
+	deque->array = NULL;
+	if (capacity == 0)
+		return C4CE_INVALID_ARG;
+	while (pow2 < capacity)
+		pow2 <<= 1;
+	deque->array = C4C_METHOD_INLINE_CALL(array_new_, pow2);
+	if (!deque->array)
+		return C4CE_MALLOC_FAIL;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(void, free, C4C_THIS deque)
+{
+	_ws_deque_array_t_* array = deque->array;
+	_ws_deque_array_t_* prev;
+	while (array) {
+		prev = array->prev;
+		C4C_FREE(array->elements);
+		C4C_FREE(array);
+		array = prev;
+	}
+	deque->top = 0;
+	deque->bottom = 0;
+	deque->array = NULL;
+}
+
+C4C_METHOD(c4c_res_t, push, C4C_THIS deque, C4C_PARAM_CONTENT_TYPE element)
+{
+	size_t bottom = __C4C_ATOMIC_LOAD_RELAXED(&deque->bottom);
+	size_t top = __C4C_ATOMIC_LOAD_ACQUIRE(&deque->top);
+	_ws_deque_array_t_* array = __C4C_ATOMIC_LOAD_RELAXED(&deque->array);
+	_ws_deque_array_t_* bigger;
+	size_t i;
+	if (bottom - top > array->mask) {
+		bigger = C4C_METHOD_INLINE_CALL(array_new_, (array->mask + 1) * 2);
+		if (!bigger)
+			return C4CE_MALLOC_FAIL;
+		for (i = top; i != bottom; ++i)
+			bigger->elements[i & bigger->mask] = array->elements[i & array->mask];
+		/* thieves that loaded the old array can still read from it */
+		bigger->prev = array;
+		__C4C_ATOMIC_STORE_RELEASE(&deque->array, bigger);
+		array = bigger;
+	}
+	array->elements[bottom & array->mask] = element;
+	__C4C_ATOMIC_STORE_RELEASE(&deque->bottom, bottom + 1);
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, pop, C4C_THIS deque, C4C_PARAM_CONTENT_TYPE* element)
+{
+	size_t bottom = __C4C_ATOMIC_LOAD_RELAXED(&deque->bottom) - 1;
+	_ws_deque_array_t_* array = __C4C_ATOMIC_LOAD_RELAXED(&deque->array);
+	size_t top;
+	int won;
+	/* Claim the bottom element first, then see if thieves got there too. */
+	__C4C_ATOMIC_STORE_RELAXED(&deque->bottom, bottom);
+	__C4C_ATOMIC_FENCE();
+	top = __C4C_ATOMIC_LOAD_RELAXED(&deque->top);
+	if ((ptrdiff_t)(bottom - top) < 0) {
+		__C4C_ATOMIC_STORE_RELAXED(&deque->bottom, bottom + 1);
+		return C4CE_EMPTY;
+	}
+	if (bottom != top) {
+		*element = array->elements[bottom & array->mask];
+		return C4CE_SUCCESS;
+	}
+	/* Last element: race the thieves for it. */
+	won = __C4C_ATOMIC_CAS_SIZE(&deque->top, top, top + 1);
+	__C4C_ATOMIC_STORE_RELAXED(&deque->bottom, bottom + 1);
+	if (!won)
+		return C4CE_EMPTY;
+	*element = array->elements[bottom & array->mask];
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, steal, C4C_THIS deque, C4C_PARAM_CONTENT_TYPE* element)
+{
+	size_t top = __C4C_ATOMIC_LOAD_ACQUIRE(&deque->top);
+	size_t bottom;
+	_ws_deque_array_t_* array;
+	C4C_PARAM_CONTENT_TYPE stolen;
+	__C4C_ATOMIC_FENCE();
+	bottom = __C4C_ATOMIC_LOAD_ACQUIRE(&deque->bottom);
+	if ((ptrdiff_t)(bottom - top) <= 0)
+		return C4CE_EMPTY;
+	array = __C4C_ATOMIC_LOAD_ACQUIRE(&deque->array);
+	/* Read before the CAS: once top moves the slot can be overwritten. */
+	stolen = array->elements[top & array->mask];
+	if (!__C4C_ATOMIC_CAS_SIZE(&deque->top, top, top + 1))
+		return C4CE_CONTENDED;
+	*element = stolen;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(size_t, size, const C4C_THIS deque)
+{
+	size_t top = __C4C_ATOMIC_LOAD_ACQUIRE(&deque->top);
+	size_t bottom = __C4C_ATOMIC_LOAD_ACQUIRE(&deque->bottom);
+	return _ws_deque_count_(top, bottom);
+}
+
+/* undef static functions macros */
+#undef _ws_deque_array_t_
+#undef _ws_deque_count_
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#undef __C4C_WS_DEQUE_ARRAY_
+#undef __C4C_WS_DEQUE_ARRAY
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/contenttype_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
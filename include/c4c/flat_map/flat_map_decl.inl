@@ -0,0 +1,264 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/**
+ * Container:
+ * 		Flat map.
+ *
+ * Brief description:
+ * 		Sorted associative container stored in a single contiguous array (same
+ * 		layout as the vector). Inspired by boost::container::flat_map.
+ * 		Lookups are branchless binary searches over contiguous memory, which beat
+ * 		pointer based trees by a wide margin on read-mostly workloads.
+ * 		With the default C4C_PARAM_OPT_KEY_OF each element is its own key and
+ * 		the container behaves as a flat set.
+ *
+ * Supports allocators: YES
+ * Container type:      STATIC/DYNAMIC
+ *
+ * Features:
+ * - O(log n) lookups (lower_bound(), find(), contains()) with an inlined
+ *   comparison and no unpredictable branches.
+ * - Batch construction: push_unsorted() everything, then build() once.
+ * - O(n) ordered insert()/erase() for occasional updates.
+ * - Optional Eytzinger layout (C4C_PARAM_OPT_EYTZINGER) for cache friendly
+ *   lookups on big containers.
+ * - Elements are stored sorted by key in data[0, size).
+ */
+
+#include "c4c/internal/allocators_decl.h"
+#include "c4c/internal/common_headers.h"
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+/*
+Parameters:
+
+#define C4C_PARAM_STRUCT_NAME 
+#define C4C_PARAM_PREFIX 
+#define C4C_PARAM_CONTENT_TYPE 
+#define C4C_PARAM_KEY_TYPE 
+#define C4C_PARAM_OPT_KEY_OF
+#define C4C_PARAM_OPT_COMPARE
+#define C4C_PARAM_OPT_EYTZINGER
+#define C4C_PARAM_OPT_GROWTH
+#define C4C_PARAM_OPT_TRIVIAL
+*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/contenttype.h"
+#include "c4c/internal/params/keytype.h"
+#include "c4c/internal/params/optkeyof.h"
+#include "c4c/internal/params/optcompare.h"
+#include "c4c/internal/params/opteytzinger.h"
+#include "c4c/internal/params/optgrowth.h"
+#include "c4c/internal/params/opttrivial.h"
+
+/* The flat map always needs an ordering: compare keys with '<' by default. */
+#ifndef C4C_PARAM_OPT_COMPARE
+#  define C4C_PARAM_OPT_COMPARE C4C_LESS
+#endif
+
+/*------------------------------------------------------------------------------
+	flat map struct definition
+------------------------------------------------------------------------------*/
+
+C4C_STRUCT_BEGIN(C4C_PARAM_STRUCT_NAME)
+	size_t size;
+	size_t capacity;
+	C4C_RAW_ARRAY(C4C_PARAM_CONTENT_TYPE, data);
+	int sorted;
+#if C4C_PARAM_OPT_EYTZINGER
+	int eytz_valid;
+	size_t eytz_capacity;
+	C4C_RAW_ARRAY(C4C_PARAM_KEY_TYPE, eytz_keys);
+	C4C_RAW_ARRAY(size_t, eytz_index);
+#endif
+C4C_STRUCT_END(C4C_PARAM_STRUCT_NAME)
+
+/*------------------------------------------------------------------------------
+	flat map functions
+------------------------------------------------------------------------------*/
+
+/**
+ * Initialize a new flat map.
+ *
+ * @param map       The flat map.
+ * @param capacity  The initial capacity. Ignored if C4C_ALLOC_STATIC has been
+ *                  defined.
+ *
+ * @retval C4CE_INVALID_ARG  Capacity is an invalid number (zero?). No
+ *                           allocation has been performed.
+ * @retval C4CE_MALLOC_FAIL  C4C_ALLOC() failed.
+ * @retval C4CE_SUCCESS      Success.
+ */
+C4C_METHOD(c4c_res_t, init, C4C_THIS map, size_t capacity);
+
+/**
+ * Free the flat map's memory and prepare for new usage (must re-initialize
+ * first).
+ *
+ * @param map  The flat map.
+ */
+C4C_METHOD(void, free, C4C_THIS map);
+
+/**
+ * Make sure the flat map can hold at least the specified number of elements
+ * without further reallocations.
+ *
+ * @param map       The flat map.
+ * @param capacity  The minimum capacity.
+ *
+ * @retval C4CE_CANT_DO       C4C_ALLOC_STATIC is defined and capacity is
+ *                            greater than the static capacity.
+ * @retval C4CE_REALLOC_FAIL  Memory reallocation failed.
+ * @retval C4CE_SUCCESS       Success.
+ * @retval C4CEW_NOTHING      The flat map can already hold capacity elements.
+ */
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS map, size_t capacity);
+
+/**
+ * Remove every element (no memory is released).
+ *
+ * @param map  The flat map.
+ */
+C4C_METHOD(void, clear, C4C_THIS map);
+
+/**
+ * Append an element without keeping the map sorted. Meant for batch
+ * construction: push everything then call build() once.
+ *
+ * @warning Lookups, insert() and erase() are not allowed until build() is
+ *          called.
+ *
+ * @param map    The flat map.
+ * @param entry  The element to add.
+ *
+ * @retval C4CE_FULL          The map is full and can't be expanded
+ *                            (C4C_ALLOC_STATIC has been defined).
+ * @retval C4CE_REALLOC_FAIL  Memory reallocation failed.
+ * @retval C4CE_SUCCESS       Success.
+ */
+C4C_METHOD(c4c_res_t, push_unsorted, C4C_THIS map, C4C_PARAM_CONTENT_TYPE entry);
+
+/**
+ * Sort the elements pushed with push_unsorted() and remove the duplicated keys
+ * (only one unspecified element per key is kept). Rebuilds the Eytzinger
+ * layout if enabled.
+ *
+ * @param map  The flat map.
+ *
+ * @retval C4CE_MALLOC_FAIL   The Eytzinger layout couldn't be allocated. The
+ *                            map is sorted and usable anyway (lookups fall back
+ *                            to the binary search).
+ * @retval C4CE_REALLOC_FAIL  Same as above.
+ * @retval C4CE_SUCCESS       Success.
+ */
+C4C_METHOD(c4c_res_t, build, C4C_THIS map);
+
+/**
+ * Insert an element keeping the map sorted.
+ *
+ * @note O(n) due to the elements being shifted. Prefer push_unsorted() and
+ *       build() for many insertions.
+ *
+ * @param map    The flat map.
+ * @param entry  The element to add.
+ *
+ * @retval C4CE_CANT_DO       The map is not built (see push_unsorted()).
+ * @retval C4CE_FULL          The map is full and can't be expanded
+ *                            (C4C_ALLOC_STATIC has been defined).
+ * @retval C4CE_REALLOC_FAIL  Memory reallocation failed.
+ * @retval C4CE_SUCCESS       Success.
+ * @retval C4CEW_NOTHING      An element with the same key already exists. The
+ *                            map has not been modified.
+ */
+C4C_METHOD(c4c_res_t, insert, C4C_THIS map, C4C_PARAM_CONTENT_TYPE entry);
+
+/**
+ * Remove the element with the specified key keeping the map sorted.
+ *
+ * @param map  The flat map.
+ * @param key  The key of the element to remove.
+ *
+ * @retval C4CE_CANT_DO   The map is not built (see push_unsorted()).
+ * @retval C4CE_SUCCESS   Success.
+ * @retval C4CEW_NOTHING  There is no element with such key.
+ */
+C4C_METHOD(c4c_res_t, erase, C4C_THIS map, C4C_PARAM_KEY_TYPE key);
+
+/**
+ * Find the position of the first element whose key is not less than the
+ * specified one.
+ *
+ * @param map  The flat map.
+ * @param key  The key to look for.
+ *
+ * @return The element's index. size if every key is less than key.
+ */
+C4C_METHOD(size_t, lower_bound, const C4C_THIS map, C4C_PARAM_KEY_TYPE key);
+
+/**
+ * Find the element with the specified key.
+ *
+ * @param map  The flat map.
+ * @param key  The key to look for.
+ *
+ * @return A pointer to the element (the key must not be modified), NULL if
+ *         not found.
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, find, C4C_THIS map, C4C_PARAM_KEY_TYPE key);
+
+/**
+ * Test whether the map contains the specified key.
+ *
+ * @param map  The flat map.
+ * @param key  The key to look for.
+ *
+ * @return 1 if found. 0 otherwise.
+ */
+C4C_METHOD(int, contains, const C4C_THIS map, C4C_PARAM_KEY_TYPE key);
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/contenttype_undef.h"
+#include "c4c/internal/params/keytype_undef.h"
+#include "c4c/internal/params/optkeyof_undef.h"
+#include "c4c/internal/params/optcompare_undef.h"
+#include "c4c/internal/params/opteytzinger_undef.h"
+#include "c4c/internal/params/optgrowth_undef.h"
+#include "c4c/internal/params/opttrivial_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
@@ -0,0 +1,415 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include "c4c/internal/allocators_impl.h"
+#include "c4c/internal/common_headers.h"
+
+#include <string.h> /* for memcpy(), memmove() */
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/contenttype.h"
+#include "c4c/internal/params/keytype.h"
+#include "c4c/internal/params/optkeyof.h"
+#include "c4c/internal/params/optcompare.h"
+#include "c4c/internal/params/opteytzinger.h"
+#include "c4c/internal/params/optgrowth.h"
+#include "c4c/internal/params/opttrivial.h"
+
+#ifndef C4C_PARAM_OPT_COMPARE
+#  define C4C_PARAM_OPT_COMPARE C4C_LESS
+#endif
+
+/*------------------------------------------------------------------------------
+    flat map static functions
+------------------------------------------------------------------------------*/
+
+/*
+ * Compare two keys ('less than').
+ */
+#define _flat_map_less_(a, b) C4C_PARAM_OPT_COMPARE((a), (b))
+
+/*
+ * Get the key of an element.
+ */
+#define _flat_map_key_(element) C4C_PARAM_OPT_KEY_OF(element)
+
+#if C4C_PARAM_OPT_TRIVIAL
+
+/*
+ * Copy n elements between two (possibly) overlapping blocks.
+ */
+#define _flat_map_move_(dst, src, n) \
+	memmove((dst), (src), sizeof(C4C_PARAM_CONTENT_TYPE) * (n))
+
+#else
+
+#define _flat_map_move_(dst, src, n) \
+	do { \
+		size_t __i; \
+		if ((dst) < (src)) { \
+			for (__i = 0; __i < (n); ++__i) \
+				(dst)[__i] = (src)[__i]; \
+		} else { \
+			for (__i = (n); __i > 0; --__i) \
+				(dst)[__i - 1] = (src)[__i - 1]; \
+		} \
+	} while (0)
+
+#endif /* C4C_PARAM_OPT_TRIVIAL */
+
+/*
+ * Make sure there is room for at least 'required' elements. If the map has to
+ * grow, the new capacity is chosen by C4C_PARAM_OPT_GROWTH.
+ */
+C4C_METHOD_INLINE(c4c_res_t, grow_, C4C_THIS map, size_t required)
+{
+#ifdef C4C_ALLOC_STATIC
+	return required > map->capacity ? C4CE_FULL : C4CE_SUCCESS;
+#else
+	C4C_PARAM_CONTENT_TYPE* data;
+	size_t capacity;
+	if (required <= map->capacity)
+		return C4CE_SUCCESS;
+	capacity = (size_t)C4C_PARAM_OPT_GROWTH(map->capacity);
+	if (capacity < required)
+		capacity = required;
+	data = C4C_REALLOC(map->data, sizeof(C4C_PARAM_CONTENT_TYPE) * capacity);
+	if (!data)
+		return C4CE_REALLOC_FAIL;
+	map->data = data;
+	map->capacity = capacity;
+	return C4CE_SUCCESS;
+#endif
+}
+
+/* Entries are sorted by key. */
+#define __C4C_SORT_TYPE C4C_PARAM_CONTENT_TYPE
+#define __C4C_SORT_LESS(a, b) _flat_map_less_(_flat_map_key_(a), _flat_map_key_(b))
+#include "c4c/internal/introsort.inl"
+
+/*
+ * Branchless binary search over the sorted elements: the loop only depends on
+ * the size so the compiler can turn the comparison into a conditional move.
+ */
+C4C_METHOD_INLINE(size_t, lower_bound_sorted_, const C4C_THIS map, C4C_PARAM_KEY_TYPE key)
+{
+	const C4C_PARAM_CONTENT_TYPE* base = map->data;
+	size_t n = map->size;
+	size_t half;
+	if (n == 0)
+		return 0;
+	while (n > 1) {
+		half = n / 2;
+		base = _flat_map_less_(_flat_map_key_(base[half]), key) ? base + half : base;
+		n -= half;
+	}
+	return (size_t)(base - map->data) + (_flat_map_less_(_flat_map_key_(*base), key) ? 1 : 0);
+}
+
+#if C4C_PARAM_OPT_EYTZINGER
+
+/*
+ * Fill the Eytzinger (BFS ordered) arrays with an in-order walk of the
+ * implicit tree. k is the 1-based tree node, i the next sorted element.
+ */
+C4C_METHOD_INLINE(size_t, eytz_fill_, C4C_THIS map, size_t i, size_t k)
+{
+	if (k <= map->size) {
+		i = C4C_METHOD_INLINE_CALL(eytz_fill_, map, i, 2 * k);
+		map->eytz_keys[k - 1] = _flat_map_key_(map->data[i]);
+		map->eytz_index[k - 1] = i;
+		i = C4C_METHOD_INLINE_CALL(eytz_fill_, map, i + 1, 2 * k + 1);
+	}
+	return i;
+}
+
+/*
+ * (Re)build the Eytzinger layout of the current (sorted) elements.
+ */
+C4C_METHOD_INLINE(c4c_res_t, eytz_build_, C4C_THIS map)
+{
+#ifdef C4C_ALLOC_DYNAMIC
+	C4C_PARAM_KEY_TYPE* keys;
+	size_t* index;
+#endif
+	map->eytz_valid = 0;
+	if (map->size == 0)
+		return C4CE_SUCCESS;
+#ifdef C4C_ALLOC_DYNAMIC
+	if (map->size > map->eytz_capacity) {
+		if (map->eytz_capacity == 0) {
+			keys = C4C_ALLOC(sizeof(C4C_PARAM_KEY_TYPE) * map->capacity);
+			index = C4C_ALLOC(sizeof(size_t) * map->capacity);
+			if (!keys || !index) {
+				C4C_FREE(keys);
+				C4C_FREE(index);
+				return C4CE_MALLOC_FAIL;
+			}
+		} else {
+			keys = C4C_REALLOC(map->eytz_keys, sizeof(C4C_PARAM_KEY_TYPE) * map->capacity);
+			if (!keys)
+				return C4CE_REALLOC_FAIL;
+			map->eytz_keys = keys;
+			index = C4C_REALLOC(map->eytz_index, sizeof(size_t) * map->capacity);
+			if (!index)
+				return C4CE_REALLOC_FAIL;
+		}
+		map->eytz_keys = keys;
+		map->eytz_index = index;
+		map->eytz_capacity = map->capacity;
+	}
+#endif
+	C4C_METHOD_INLINE_CALL(eytz_fill_, map, 0, 1);
+	map->eytz_valid = 1;
+	return C4CE_SUCCESS;
+}
+
+/*
+ * Lower bound over the Eytzinger layout: descend the implicit tree (children
+ * of k are 2k and 2k+1, all prefetch friendly) then drop the trailing right
+ * turns and the last left turn to get the answer.
+ */
+C4C_METHOD_INLINE(size_t, lower_bound_eytz_, const C4C_THIS map, C4C_PARAM_KEY_TYPE key)
+{
+	size_t k = 1;
+	while (k <= map->size)
+		k = 2 * k + (_flat_map_less_(map->eytz_keys[k - 1], key) ? 1 : 0);
+	while (k & 1)
+		k >>= 1;
+	k >>= 1;
+	return k == 0 ? map->size : map->eytz_index[k - 1];
+}
+
+#endif /* C4C_PARAM_OPT_EYTZINGER */
+
+/*------------------------------------------------------------------------------
+    flat map functions implementation
+------------------------------------------------------------------------------*/
+
+C4C_METHOD(c4c_res_t, init, C4C_THIS map, size_t capacity)
+{
+	map->size = 0;
+	map->sorted = 1;
+#if C4C_PARAM_OPT_EYTZINGER
+	map->eytz_valid = 0;
+#  ifdef C4C_ALLOC_DYNAMIC
+	map->eytz_capacity = 0;
+	map->eytz_keys = NULL;
+	map->eytz_index = NULL;
+#  else
+	map->eytz_capacity = C4C_ALLOC_STATIC;
+#  endif
+#endif
+#ifdef C4C_ALLOC_DYNAMIC
+	map->capacity = capacity;
+	if (capacity == 0) {
+		map->data = NULL;
+		return C4CE_INVALID_ARG;
+	}
+	map->data = C4C_ALLOC(sizeof(C4C_PARAM_CONTENT_TYPE) * capacity);
+	if (!map->data) {
+		map->capacity = 0;
+		return C4CE_MALLOC_FAIL;
+	}
+#else
+	map->capacity = C4C_ALLOC_STATIC;
+#endif
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(void, free, C4C_THIS map)
+{
+	map->size = 0;
+	map->capacity = 0;
+	map->sorted = 1;
+#if C4C_PARAM_OPT_EYTZINGER
+	map->eytz_valid = 0;
+	map->eytz_capacity = 0;
+#  ifdef C4C_ALLOC_DYNAMIC
+	C4C_FREE(map->eytz_keys);
+	C4C_FREE(map->eytz_index);
+	map->eytz_keys = NULL;
+	map->eytz_index = NULL;
+#  endif
+#endif
+#ifdef C4C_ALLOC_STATIC
+	return;
+#else
+	C4C_FREE(map->data);
+	map->data = NULL;
+#endif
+}
+
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS map, size_t capacity)
+{
+	if (capacity <= map->capacity)
+		return C4CEW_NOTHING;
+#ifdef C4C_ALLOC_STATIC
+	return C4CE_CANT_DO;
+#else
+	{
+		C4C_PARAM_CONTENT_TYPE* data;
+		data = C4C_REALLOC(map->data, sizeof(C4C_PARAM_CONTENT_TYPE) * capacity);
+		if (!data)
+			return C4CE_REALLOC_FAIL;
+		map->data = data;
+		map->capacity = capacity;
+		return C4CE_SUCCESS;
+	}
+#endif
+}
+
+C4C_METHOD(void, clear, C4C_THIS map)
+{
+	map->size = 0;
+	map->sorted = 1;
+#if C4C_PARAM_OPT_EYTZINGER
+	map->eytz_valid = 0;
+#endif
+}
+
+C4C_METHOD(c4c_res_t, push_unsorted, C4C_THIS map, C4C_PARAM_CONTENT_TYPE entry)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, map, map->size + 1)))
+		return err;
+	map->data[map->size] = entry;
+	++map->size;
+	map->sorted = 0;
+#if C4C_PARAM_OPT_EYTZINGER
+	map->eytz_valid = 0;
+#endif
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, build, C4C_THIS map)
+{
+	size_t i, last;
+	if (!map->sorted) {
+		C4C_METHOD_INLINE_CALL(introsort_, map->data, map->size);
+		/* Keep the first element of every run of equal keys. */
+		for (i = 1, last = 0; i < map->size; ++i) {
+			if (_flat_map_less_(_flat_map_key_(map->data[last]), _flat_map_key_(map->data[i])))
+				map->data[++last] = map->data[i];
+		}
+		if (map->size != 0)
+			map->size = last + 1;
+		map->sorted = 1;
+	}
+#if C4C_PARAM_OPT_EYTZINGER
+	if (!map->eytz_valid)
+		return C4C_METHOD_INLINE_CALL(eytz_build_, map);
+#endif
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, insert, C4C_THIS map, C4C_PARAM_CONTENT_TYPE entry)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	C4C_PARAM_KEY_TYPE key = _flat_map_key_(entry);
+	size_t index;
+	if (!map->sorted)
+		return C4CE_CANT_DO;
+	index = C4C_METHOD_CALL(lower_bound, map, key);
+	if (index < map->size && !_flat_map_less_(key, _flat_map_key_(map->data[index])))
+		return C4CEW_NOTHING;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, map, map->size + 1)))
+		return err;
+	_flat_map_move_(map->data + index + 1, map->data + index, map->size - index);
+	map->data[index] = entry;
+	++map->size;
+#if C4C_PARAM_OPT_EYTZINGER
+	map->eytz_valid = 0;
+#endif
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, erase, C4C_THIS map, C4C_PARAM_KEY_TYPE key)
+{
+	size_t index;
+	if (!map->sorted)
+		return C4CE_CANT_DO;
+	index = C4C_METHOD_CALL(lower_bound, map, key);
+	if (index == map->size || _flat_map_less_(key, _flat_map_key_(map->data[index])))
+		return C4CEW_NOTHING;
+	_flat_map_move_(map->data + index, map->data + index + 1, map->size - index - 1);
+	--map->size;
+#if C4C_PARAM_OPT_EYTZINGER
+	map->eytz_valid = 0;
+#endif
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(size_t, lower_bound, const C4C_THIS map, C4C_PARAM_KEY_TYPE key)
+{
+#if C4C_PARAM_OPT_EYTZINGER
+	if (map->eytz_valid)
+		return C4C_METHOD_INLINE_CALL(lower_bound_eytz_, map, key);
+#endif
+	return C4C_METHOD_INLINE_CALL(lower_bound_sorted_, map, key);
+}
+
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, find, C4C_THIS map, C4C_PARAM_KEY_TYPE key)
+{
+	size_t index = C4C_METHOD_CALL(lower_bound, map, key);
+	if (index == map->size || _flat_map_less_(key, _flat_map_key_(map->data[index])))
+		return NULL;
+	return &map->data[index];
+}
+
+C4C_METHOD(int, contains, const C4C_THIS map, C4C_PARAM_KEY_TYPE key)
+{
+	size_t index = C4C_METHOD_CALL(lower_bound, map, key);
+	return index != map->size && !_flat_map_less_(key, _flat_map_key_(map->data[index]));
+}
+
+/* undef static functions macros */
+#undef _flat_map_less_
+#undef _flat_map_key_
+#undef _flat_map_move_
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/contenttype_undef.h"
+#include "c4c/internal/params/keytype_undef.h"
+#include "c4c/internal/params/optkeyof_undef.h"
+#include "c4c/internal/params/optcompare_undef.h"
+#include "c4c/internal/params/opteytzinger_undef.h"
+#include "c4c/internal/params/optgrowth_undef.h"
+#include "c4c/internal/params/opttrivial_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
@@ -92,12 +92,45 @@
 	macros
 ------------------------------------------------------------------------------*/
 
-#ifdef C4C_ALLOC_DYNAMIC
-#  ifndef C4C_RAW_ARRAY
-#    define C4C_RAW_ARRAY(type_, name_) type_* name_
+/*
+ * Align a declaration (struct member or variable) to alignment_ bytes (power
+ * of two).
+ */
+#ifndef C4C_ALIGNAS
+#  if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#    define C4C_ALIGNAS(alignment_) _Alignas(alignment_)
+#  elif defined(__GNUC__) || defined(__clang__)
+#    define C4C_ALIGNAS(alignment_) __attribute__((aligned(alignment_)))
+#  elif defined(_MSC_VER)
+#    define C4C_ALIGNAS(alignment_) __declspec(align(alignment_))
+#  else
+#    error C4C_ALIGNAS is not available for this compiler: define it before including c4c.
 #  endif
-#else /* C4C_ALLOC_STATIC */
-#  ifndef C4C_RAW_ARRAY
+#endif
+
+/*
+ * The storage macros depend on the current allocation mode: the default ones
+ * get undefined by allocators_undef.h (custom ones are left alone).
+ */
+#ifndef C4C_RAW_ARRAY
+#  define __C4C_RAW_ARRAY_DEFAULT
+#  ifdef C4C_ALLOC_DYNAMIC
+#    define C4C_RAW_ARRAY(type_, name_) type_* name_
+#  else /* C4C_ALLOC_STATIC */
 #    define C4C_RAW_ARRAY(type_, name_) type_ name_[C4C_ALLOC_STATIC]
 #  endif
 #endif
+
+/*
+ * Same as C4C_RAW_ARRAY but static arrays are aligned to alignment_ bytes
+ * (dynamic ones are aligned upon allocation, see C4C_ALIGNED_ALLOC).
+ */
+#ifndef C4C_RAW_ARRAY_ALIGNED
+#  define __C4C_RAW_ARRAY_ALIGNED_DEFAULT
+#  ifdef C4C_ALLOC_DYNAMIC
+#    define C4C_RAW_ARRAY_ALIGNED(type_, name_, alignment_) type_* name_
+#  else /* C4C_ALLOC_STATIC */
+#    define C4C_RAW_ARRAY_ALIGNED(type_, name_, alignment_) \
+	C4C_ALIGNAS(alignment_) type_ name_[C4C_ALLOC_STATIC]
+#  endif
+#endif
@@ -46,3 +46,55 @@
 #ifndef C4C_FREE
 #  define C4C_FREE(ptr_)			free(ptr_)
 #endif
+
+/*
+ * Aligned allocations: C4C_ALIGNED_ALLOC(alignment_, size_) must return a
+ * block of size_ bytes aligned to alignment_ (power of two) to be released
+ * with C4C_ALIGNED_FREE(ptr_). Define both or none of them.
+ * The default ones work on top of C4C_ALLOC/C4C_FREE by over-allocating and
+ * storing the original pointer right before the aligned block.
+ */
+#if defined(C4C_ALIGNED_ALLOC) != defined(C4C_ALIGNED_FREE)
+#  error C4C_ALIGNED_ALLOC and C4C_ALIGNED_FREE must be defined together.
+#endif
+
+#ifndef C4C_ALIGNED_ALLOC
+
+#ifndef __C4C_ALIGNED_ALLOC_DEFAULT__
+#define __C4C_ALIGNED_ALLOC_DEFAULT__
+
+/* Not every container including this file needs them. */
+#if defined(__GNUC__) || defined(__clang__)
+#  define __C4C_ALIGNED_UNUSED __attribute__((unused))
+#else
+#  define __C4C_ALIGNED_UNUSED
+#endif
+
+__C4C_ALIGNED_UNUSED static void* c4c_aligned_alloc_(size_t alignment, size_t size)
+{
+	char* raw;
+	char* aligned;
+	if (alignment < sizeof(void*))
+		alignment = sizeof(void*);
+	raw = (char*)C4C_ALLOC(size + alignment + sizeof(void*));
+	if (!raw)
+		return NULL;
+	aligned = raw + sizeof(void*);
+	aligned += (alignment - ((size_t)aligned & (alignment - 1))) & (alignment - 1);
+	((void**)aligned)[-1] = raw;
+	return aligned;
+}
+
+__C4C_ALIGNED_UNUSED static void c4c_aligned_free_(void* ptr)
+{
+	if (ptr)
+		C4C_FREE(((void**)ptr)[-1]);
+}
+
+#undef __C4C_ALIGNED_UNUSED
+
+#endif /* __C4C_ALIGNED_ALLOC_DEFAULT__ */
+
+#  define C4C_ALIGNED_ALLOC(alignment_, size_)	c4c_aligned_alloc_(alignment_, size_)
+#  define C4C_ALIGNED_FREE(ptr_)				c4c_aligned_free_(ptr_)
+#endif
@@ -28,3 +28,13 @@
 
 #undef C4C_ALLOC_DYNAMIC
 #undef C4C_ALLOC_STATIC
+
+#ifdef __C4C_RAW_ARRAY_DEFAULT
+#  undef C4C_RAW_ARRAY
+#  undef __C4C_RAW_ARRAY_DEFAULT
+#endif
+
+#ifdef __C4C_RAW_ARRAY_ALIGNED_DEFAULT
+#  undef C4C_RAW_ARRAY_ALIGNED
+#  undef __C4C_RAW_ARRAY_ALIGNED_DEFAULT
+#endif
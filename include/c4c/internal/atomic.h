@@ -0,0 +1,188 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#ifndef __C4C_ATOMIC_H__
+#define __C4C_ATOMIC_H__
+
+#include <stddef.h> /* for size_t */
+#include <stdint.h> /* for uint64_t, uintptr_t */
+
+/*
+ * Minimal set of atomic operations used by the concurrent containers. ptr
+ * always points to a volatile object.
+ *
+ * __C4C_ATOMIC_LOAD_RELAXED(ptr):              *ptr, no ordering.
+ * __C4C_ATOMIC_STORE_RELAXED(ptr, val):        *ptr = val, no ordering.
+ * __C4C_ATOMIC_LOAD_ACQUIRE(ptr):              *ptr with acquire semantics.
+ * __C4C_ATOMIC_LOAD_CONSUME(ptr):              *ptr, ordered only before the
+ *                                              loads depending on its value.
+ *                                              ptr may point to a non
+ *                                              volatile object.
+ * __C4C_ATOMIC_STORE_RELEASE(ptr, val):        *ptr = val with release
+ *                                              semantics.
+ * __C4C_ATOMIC_FETCH_ADD_SIZE(ptr, val):       *ptr += val (size_t), return
+ *                                              the old value. Full barrier.
+ * __C4C_ATOMIC_CAS_PTR(ptr, expected, desired): if *ptr == expected then
+ *                                              *ptr = desired. Return 1 on
+ *                                              success, 0 otherwise. Full
+ *                                              barrier.
+ * __C4C_ATOMIC_CAS_SIZE(ptr, expected, desired): as above for size_t.
+ * __C4C_ATOMIC_FENCE():                        sequentially consistent fence.
+ */
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define __C4C_ATOMIC_LOAD_RELAXED(ptr) \
+	__atomic_load_n(ptr, __ATOMIC_RELAXED)
+#  define __C4C_ATOMIC_STORE_RELAXED(ptr, val) \
+	__atomic_store_n(ptr, val, __ATOMIC_RELAXED)
+#  define __C4C_ATOMIC_LOAD_ACQUIRE(ptr) \
+	__atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#  define __C4C_ATOMIC_LOAD_CONSUME(ptr) \
+	__atomic_load_n(ptr, __ATOMIC_CONSUME)
+#  define __C4C_ATOMIC_STORE_RELEASE(ptr, val) \
+	__atomic_store_n(ptr, val, __ATOMIC_RELEASE)
+#  define __C4C_ATOMIC_FETCH_ADD_SIZE(ptr, val) \
+	__atomic_fetch_add(ptr, (size_t)(val), __ATOMIC_SEQ_CST)
+#  define __C4C_ATOMIC_CAS_PTR(ptr, expected, desired) \
+	((int)__sync_bool_compare_and_swap(ptr, expected, desired))
+#  define __C4C_ATOMIC_CAS_SIZE(ptr, expected, desired) \
+	((int)__sync_bool_compare_and_swap(ptr, (size_t)(expected), (size_t)(desired)))
+#  define __C4C_ATOMIC_FENCE() \
+	__atomic_thread_fence(__ATOMIC_SEQ_CST)
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#  include <intrin.h> /* for the _Interlocked*() intrinsics */
+/* x86 loads/stores are acquire/release already and volatile accesses can't
+ * be reordered by the compiler (/volatile:ms is the default on x86/x64). */
+#  define __C4C_ATOMIC_LOAD_RELAXED(ptr) \
+	(*(ptr))
+#  define __C4C_ATOMIC_STORE_RELAXED(ptr, val) \
+	((void)(*(ptr) = (val)))
+#  define __C4C_ATOMIC_LOAD_ACQUIRE(ptr) \
+	(*(ptr))
+/* Dependent loads can't be reordered before the load they depend on. */
+#  define __C4C_ATOMIC_LOAD_CONSUME(ptr) \
+	(*(ptr))
+#  define __C4C_ATOMIC_STORE_RELEASE(ptr, val) \
+	((void)(*(ptr) = (val)))
+#  ifdef _M_X64
+#    define __C4C_ATOMIC_FETCH_ADD_SIZE(ptr, val) \
+	((size_t)_InterlockedExchangeAdd64((volatile __int64*)(ptr), (__int64)(val)))
+#    define __C4C_ATOMIC_CAS_SIZE(ptr, expected, desired) \
+	(_InterlockedCompareExchange64((volatile __int64*)(ptr), (__int64)(desired), \
+		(__int64)(expected)) == (__int64)(expected))
+#  else
+#    define __C4C_ATOMIC_FETCH_ADD_SIZE(ptr, val) \
+	((size_t)_InterlockedExchangeAdd((volatile long*)(ptr), (long)(val)))
+#    define __C4C_ATOMIC_CAS_SIZE(ptr, expected, desired) \
+	(_InterlockedCompareExchange((volatile long*)(ptr), (long)(desired), \
+		(long)(expected)) == (long)(expected))
+#  endif
+#  define __C4C_ATOMIC_FENCE() \
+	_mm_mfence()
+#  define __C4C_ATOMIC_CAS_PTR(ptr, expected, desired) \
+	(_InterlockedCompareExchangePointer((void* volatile*)(ptr), (void*)(desired), \
+		(void*)(expected)) == (void*)(expected))
+#else
+#  error No atomic operations available for this compiler.
+#endif
+
+/*
+ * Tagged pointers: a pointer plus a counter swapped as a single value so that a
+ * compare-and-swap fails if the pointer has been changed and changed back in
+ * the meantime (ABA problem) as long as the counter is bumped on every change.
+ *
+ * c4c_tagged_ptr_t:                               the tagged pointer type.
+ * __C4C_TAGGED_BITS:                              the counter width in bits.
+ * __C4C_TAGGED_MAKE(ptr, tag):                    build a tagged pointer.
+ * __C4C_TAGGED_PTR(t):                            the pointer (void*).
+ * __C4C_TAGGED_TAG(t):                            the counter.
+ * __C4C_ATOMIC_LOAD_TAGGED(ptr):                  *ptr. May be torn when a
+ *                                                 double width compare-and-swap
+ *                                                 is used: the following CAS
+ *                                                 will then simply fail.
+ * __C4C_ATOMIC_CAS_TAGGED(ptr, expected, desired): as __C4C_ATOMIC_CAS_PTR().
+ *
+ * Three layouts, from the most to the least robust:
+ * - 64 bit pointers with a 16 byte CAS (GCC/clang with -mcx16 or an -march
+ *   that implies it, AArch64...): pointer + 64 bit counter.
+ * - 32 bit pointers: pointer + 32 bit counter in a 64 bit word.
+ * - 64 bit pointers otherwise (MSVC x64, GCC without -mcx16): 48 bit pointer +
+ *   16 bit counter in a 64 bit word. Relies on user space addresses fitting in
+ *   48 bits (sign extended), true on x86-64 and AArch64 without 5 level
+ *   paging / 52 bit address space opt-in.
+ */
+
+#if UINTPTR_MAX > 0xFFFFFFFFu && defined(__SIZEOF_INT128__) && \
+	defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+__extension__ typedef unsigned __int128 c4c_tagged_ptr_t;
+#  define __C4C_TAGGED_BITS 64
+#  define __C4C_TAGGED_MAKE(ptr, tag) \
+	(((c4c_tagged_ptr_t)(uint64_t)(tag) << 64) | (c4c_tagged_ptr_t)(uintptr_t)(ptr))
+#  define __C4C_TAGGED_PTR(t) \
+	((void*)(uintptr_t)(t))
+#  define __C4C_TAGGED_TAG(t) \
+	((uint64_t)((t) >> 64))
+#  define __C4C_ATOMIC_LOAD_TAGGED(ptr) \
+	(*(ptr))
+#elif UINTPTR_MAX <= 0xFFFFFFFFu
+typedef uint64_t c4c_tagged_ptr_t;
+#  define __C4C_TAGGED_BITS 32
+#  define __C4C_TAGGED_MAKE(ptr, tag) \
+	(((uint64_t)(uint32_t)(tag) << 32) | (uint64_t)(uintptr_t)(ptr))
+#  define __C4C_TAGGED_PTR(t) \
+	((void*)(uintptr_t)(uint32_t)(t))
+#  define __C4C_TAGGED_TAG(t) \
+	((uint64_t)((t) >> 32))
+#else
+typedef uint64_t c4c_tagged_ptr_t;
+#  define __C4C_TAGGED_BITS 16
+#  define __C4C_TAGGED_MAKE(ptr, tag) \
+	(((uint64_t)(tag) << 48) | ((uint64_t)(uintptr_t)(ptr) & (((uint64_t)1 << 48) - 1)))
+#  define __C4C_TAGGED_PTR(t) \
+	((void*)(uintptr_t)((int64_t)((t) << 16) >> 16))
+#  define __C4C_TAGGED_TAG(t) \
+	((uint64_t)((t) >> 48))
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#  ifndef __C4C_ATOMIC_LOAD_TAGGED
+#    define __C4C_ATOMIC_LOAD_TAGGED(ptr) \
+	__atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#  endif
+#  define __C4C_ATOMIC_CAS_TAGGED(ptr, expected, desired) \
+	((int)__sync_bool_compare_and_swap(ptr, expected, desired))
+#else
+/* A torn read on x86 just makes the following CAS fail. */
+#  define __C4C_ATOMIC_LOAD_TAGGED(ptr) \
+	(*(ptr))
+#  define __C4C_ATOMIC_CAS_TAGGED(ptr, expected, desired) \
+	(_InterlockedCompareExchange64((volatile __int64*)(ptr), (__int64)(desired), \
+		(__int64)(expected)) == (__int64)(expected))
+#endif
+
+#endif /* __C4C_ATOMIC_H__ */
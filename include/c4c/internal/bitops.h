@@ -0,0 +1,108 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#ifndef __C4C_BITOPS_H__
+#define __C4C_BITOPS_H__
+
+#include <stdint.h> /* for uint64_t */
+
+/*
+ * 64 bit word helpers used by the containers.
+ *
+ * __C4C_POPCOUNT64(x): number of set bits in x.
+ * __C4C_CTZ64(x):      index of the lowest set bit in x (x must not be zero).
+ * __C4C_CLZ64(x):      number of zero bits above the highest set bit in x (x
+ *                      must not be zero).
+ *
+ * They compile to a single instruction when the compiler targets it (e.g.
+ * -mpopcnt/-mbmi/-mlzcnt or -march=native with GCC/clang, /arch:AVX with MSVC)
+ * and to portable bit tricks otherwise.
+ */
+
+#define __C4C_U64(hi, lo) (((uint64_t)(hi) << 32) | (uint64_t)(lo))
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define __C4C_POPCOUNT64(x) ((unsigned)__builtin_popcountll(x))
+#  define __C4C_CTZ64(x) ((unsigned)__builtin_ctzll(x))
+#  define __C4C_CLZ64(x) ((unsigned)__builtin_clzll(x))
+#else
+static unsigned c4c_popcount64_(uint64_t x)
+{
+	x = x - ((x >> 1) & __C4C_U64(0x55555555u, 0x55555555u));
+	x = (x & __C4C_U64(0x33333333u, 0x33333333u)) + ((x >> 2) & __C4C_U64(0x33333333u, 0x33333333u));
+	x = (x + (x >> 4)) & __C4C_U64(0x0F0F0F0Fu, 0x0F0F0F0Fu);
+	return (unsigned)((x * __C4C_U64(0x01010101u, 0x01010101u)) >> 56);
+}
+
+#  if defined(_MSC_VER) && defined(_M_X64)
+#    include <intrin.h> /* for __popcnt64(), _BitScanForward64(), _BitScanReverse64() */
+#    ifdef __AVX__
+#      define __C4C_POPCOUNT64(x) ((unsigned)__popcnt64(x))
+#    else
+#      define __C4C_POPCOUNT64(x) c4c_popcount64_(x)
+#    endif
+
+static unsigned c4c_ctz64_(uint64_t x)
+{
+	unsigned long index;
+	_BitScanForward64(&index, x);
+	return (unsigned)index;
+}
+
+static unsigned c4c_clz64_(uint64_t x)
+{
+	unsigned long index;
+	_BitScanReverse64(&index, x);
+	return 63 - (unsigned)index;
+}
+#  else
+#    define __C4C_POPCOUNT64(x) c4c_popcount64_(x)
+
+static unsigned c4c_ctz64_(uint64_t x)
+{
+	/* bits below the lowest set one */
+	return c4c_popcount64_((x & (~x + 1)) - 1);
+}
+
+static unsigned c4c_clz64_(uint64_t x)
+{
+	/* set every bit below the highest set one */
+	x |= x >> 1;
+	x |= x >> 2;
+	x |= x >> 4;
+	x |= x >> 8;
+	x |= x >> 16;
+	x |= x >> 32;
+	return 64 - c4c_popcount64_(x);
+}
+#  endif
+#  define __C4C_CTZ64(x) c4c_ctz64_(x)
+#  define __C4C_CLZ64(x) c4c_clz64_(x)
+#endif
+
+#endif /* __C4C_BITOPS_H__ */
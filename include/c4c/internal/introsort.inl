@@ -0,0 +1,167 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/*
+ * Internal introsort template shared by the sortable containers.
+ *
+ * Generates the static function <prefix>_introsort_(array, n) sorting an array
+ * of __C4C_SORT_TYPE with the __C4C_SORT_LESS(a, b) ordering (both must be
+ * defined before including this file and get undefined at its end).
+ */
+
+#ifndef __C4C_SORT_TYPE
+#  error __C4C_SORT_TYPE must be defined before including introsort.inl.
+#endif
+
+#ifndef __C4C_SORT_LESS
+#  error __C4C_SORT_LESS must be defined before including introsort.inl.
+#endif
+
+/*
+ * Below this size partitions are left to the final insertion sort.
+ */
+#define _introsort_threshold_ 16
+
+#define _introsort_swap_(a, b) \
+	do { \
+		__C4C_SORT_TYPE __tmp = (a); \
+		(a) = (b); \
+		(b) = __tmp; \
+	} while (0)
+
+C4C_METHOD_INLINE(void, insertion_sort_, __C4C_SORT_TYPE* a, size_t n)
+{
+	size_t i, j;
+	__C4C_SORT_TYPE tmp;
+	for (i = 1; i < n; ++i) {
+		tmp = a[i];
+		for (j = i; j > 0 && __C4C_SORT_LESS(tmp, a[j - 1]); --j)
+			a[j] = a[j - 1];
+		a[j] = tmp;
+	}
+}
+
+C4C_METHOD_INLINE(void, sift_down_, __C4C_SORT_TYPE* a, size_t root, size_t n)
+{
+	size_t child;
+	__C4C_SORT_TYPE tmp = a[root];
+	while ((child = 2 * root + 1) < n) {
+		if (child + 1 < n && __C4C_SORT_LESS(a[child], a[child + 1]))
+			++child;
+		if (!__C4C_SORT_LESS(tmp, a[child]))
+			break;
+		a[root] = a[child];
+		root = child;
+	}
+	a[root] = tmp;
+}
+
+C4C_METHOD_INLINE(void, heap_sort_, __C4C_SORT_TYPE* a, size_t n)
+{
+	size_t i;
+	for (i = n / 2; i > 0; --i)
+		C4C_METHOD_INLINE_CALL(sift_down_, a, i - 1, n);
+	for (i = n - 1; i > 0; --i) {
+		_introsort_swap_(a[0], a[i]);
+		C4C_METHOD_INLINE_CALL(sift_down_, a, 0, i);
+	}
+}
+
+/*
+ * Quicksort the partitions bigger than _introsort_threshold_ falling back to
+ * heap sort once depth reaches zero.
+ */
+C4C_METHOD_INLINE(void, introsort_loop_, __C4C_SORT_TYPE* a, size_t n, size_t depth)
+{
+	size_t i, j, mid;
+	while (n > _introsort_threshold_) {
+		if (depth == 0) {
+			C4C_METHOD_INLINE_CALL(heap_sort_, a, n);
+			return;
+		}
+		--depth;
+		/* Move the median of a[1], a[mid], a[n - 1] to a[0] and use it as the
+		 * pivot. The other two act as sentinels for the partitioning loop. */
+		mid = n / 2;
+		if (__C4C_SORT_LESS(a[1], a[mid])) {
+			if (__C4C_SORT_LESS(a[mid], a[n - 1]))
+				_introsort_swap_(a[0], a[mid]);
+			else if (__C4C_SORT_LESS(a[1], a[n - 1]))
+				_introsort_swap_(a[0], a[n - 1]);
+			else
+				_introsort_swap_(a[0], a[1]);
+		} else if (__C4C_SORT_LESS(a[1], a[n - 1])) {
+			_introsort_swap_(a[0], a[1]);
+		} else if (__C4C_SORT_LESS(a[mid], a[n - 1])) {
+			_introsort_swap_(a[0], a[n - 1]);
+		} else {
+			_introsort_swap_(a[0], a[mid]);
+		}
+		i = 1;
+		j = n;
+		for (;;) {
+			while (__C4C_SORT_LESS(a[i], a[0]))
+				++i;
+			--j;
+			while (__C4C_SORT_LESS(a[0], a[j]))
+				--j;
+			if (i >= j)
+				break;
+			_introsort_swap_(a[i], a[j]);
+			++i;
+		}
+		/* Recurse on the smaller partition, loop on the bigger one. */
+		if (i < n - i) {
+			C4C_METHOD_INLINE_CALL(introsort_loop_, a, i, depth);
+			a += i;
+			n -= i;
+		} else {
+			C4C_METHOD_INLINE_CALL(introsort_loop_, a + i, n - i, depth);
+			n = i;
+		}
+	}
+}
+
+/*
+ * Sort n elements: introsort down to small partitions then a single insertion
+ * sort pass over the whole (almost sorted) array.
+ */
+C4C_METHOD_INLINE(void, introsort_, __C4C_SORT_TYPE* a, size_t n)
+{
+	size_t i, depth = 0;
+	for (i = n; i > 1; i >>= 1)
+		depth += 2;
+	C4C_METHOD_INLINE_CALL(introsort_loop_, a, n, depth);
+	C4C_METHOD_INLINE_CALL(insertion_sort_, a, n);
+}
+
+#undef _introsort_threshold_
+#undef _introsort_swap_
+
+#undef __C4C_SORT_TYPE
+#undef __C4C_SORT_LESS
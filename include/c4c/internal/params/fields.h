@@ -0,0 +1,58 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/*------------------------------------------------------------------------------
+	parameters
+------------------------------------------------------------------------------*/
+
+/**
+ * Description:
+ * 		The container's fields as an X-macro: a function-like macro receiving
+ * 		another macro and invoking it once per field with its type and name.
+ * 		Every field gets its own array inside the container.
+ * 		Field names must be valid identifiers and must not collide with the
+ * 		container's functions nor with its 'size'/'capacity' members.
+ *
+ * Expected type:
+ * 		<X(type, name) X(type, name) ...>
+ *
+ * Examples:
+ * 		#define PARTICLE_FIELDS(X) X(float, x) X(float, y) X(int, id)
+ * 		PARTICLE_FIELDS
+ */
+/*
+#define C4C_PARAM_FIELDS
+*/
+
+/*------------------------------------------------------------------------------
+	parameters checks
+------------------------------------------------------------------------------*/
+
+#ifndef C4C_PARAM_FIELDS
+#  error C4C_PARAM_FIELDS must be defined for the current container.
+#endif
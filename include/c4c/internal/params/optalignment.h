@@ -0,0 +1,67 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/*------------------------------------------------------------------------------
+	parameters
+------------------------------------------------------------------------------*/
+
+/**
+ * Description:
+ * 		Alignment in bytes of the container's storage. Must be a power of two
+ * 		(or 0 for the natural alignment of the content type). Dynamic storage
+ * 		is allocated with C4C_ALIGNED_ALLOC/C4C_ALIGNED_FREE, static storage is
+ * 		declared with C4C_ALIGNAS.
+ * 		Useful for aligned SIMD loads, to keep elements from straddling cache
+ * 		lines (64) or to back big containers with huge pages (2097152).
+ *
+ * Expected type:
+ * 		<size_t> (power of two or 0)
+ *
+ * Default value:
+ * 		0
+ *
+ * Examples:
+ * 		16
+ * 		64
+ * 		4096
+ */
+/*
+#define C4C_PARAM_OPT_ALIGNMENT
+*/
+
+/*------------------------------------------------------------------------------
+	parameters checks
+------------------------------------------------------------------------------*/
+
+#ifndef C4C_PARAM_OPT_ALIGNMENT
+#  define C4C_PARAM_OPT_ALIGNMENT 0
+#else
+#  if (C4C_PARAM_OPT_ALIGNMENT) < 0 || ((C4C_PARAM_OPT_ALIGNMENT) & ((C4C_PARAM_OPT_ALIGNMENT) - 1)) != 0
+#    error C4C_PARAM_OPT_ALIGNMENT must be a power of two (or 0).
+#  endif
+#endif
@@ -0,0 +1,113 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/*------------------------------------------------------------------------------
+	parameters
+------------------------------------------------------------------------------*/
+
+/**
+ * Description:
+ * 		Declare the container's content type as an arithmetic type, enabling
+ * 		the vectorized find(), count(), contains(), min(), max() and sum()
+ * 		functions. The value tells the exact type: the content type must have
+ * 		the same size and representation (i.e. int32_t and int are both fine
+ * 		for C4C_ARITH_INT32 on most platforms).
+ * 		C4C_ARITH_GENERIC works with any type supporting == and < but uses
+ * 		plain loops only.
+ * 		If left undefined such functions won't be generated.
+ *
+ * Expected type:
+ * 		<one of the C4C_ARITH_xxx constants>
+ *
+ * Examples:
+ * 		C4C_ARITH_INT32
+ * 		C4C_ARITH_UINT64
+ * 		C4C_ARITH_FLOAT
+ * 		C4C_ARITH_GENERIC
+ */
+/*
+#define C4C_PARAM_OPT_ARITHMETIC
+*/
+
+/*------------------------------------------------------------------------------
+	built-in arithmetic kinds
+------------------------------------------------------------------------------*/
+
+/* Numbered from 1: a misspelled kind expands to 0 in #if and gets rejected. */
+
+#ifndef C4C_ARITH_GENERIC
+#  define C4C_ARITH_GENERIC	1
+#endif
+
+#ifndef C4C_ARITH_INT32
+#  define C4C_ARITH_INT32	2
+#endif
+
+#ifndef C4C_ARITH_UINT32
+#  define C4C_ARITH_UINT32	3
+#endif
+
+#ifndef C4C_ARITH_INT64
+#  define C4C_ARITH_INT64	4
+#endif
+
+#ifndef C4C_ARITH_UINT64
+#  define C4C_ARITH_UINT64	5
+#endif
+
+#ifndef C4C_ARITH_FLOAT
+#  define C4C_ARITH_FLOAT	6
+#endif
+
+#ifndef C4C_ARITH_DOUBLE
+#  define C4C_ARITH_DOUBLE	7
+#endif
+
+/*------------------------------------------------------------------------------
+	parameters checks
+------------------------------------------------------------------------------*/
+
+#ifdef C4C_PARAM_OPT_ARITHMETIC
+#  if C4C_PARAM_OPT_ARITHMETIC < C4C_ARITH_GENERIC || C4C_PARAM_OPT_ARITHMETIC > C4C_ARITH_DOUBLE || \
+	C4C_PARAM_OPT_ARITHMETIC == 0
+#    error C4C_PARAM_OPT_ARITHMETIC must be one of the C4C_ARITH_xxx constants.
+#  endif
+/* The type returned by sum(): integers are widened to 64 bits, floating
+ * points to double. */
+#  if C4C_PARAM_OPT_ARITHMETIC == C4C_ARITH_GENERIC
+#    define __C4C_ARITH_SUM_TYPE C4C_PARAM_CONTENT_TYPE
+#  elif C4C_PARAM_OPT_ARITHMETIC == C4C_ARITH_INT32 || C4C_PARAM_OPT_ARITHMETIC == C4C_ARITH_INT64
+#    include <stdint.h>
+#    define __C4C_ARITH_SUM_TYPE int64_t
+#  elif C4C_PARAM_OPT_ARITHMETIC == C4C_ARITH_UINT32 || C4C_PARAM_OPT_ARITHMETIC == C4C_ARITH_UINT64
+#    include <stdint.h>
+#    define __C4C_ARITH_SUM_TYPE uint64_t
+#  else
+#    define __C4C_ARITH_SUM_TYPE double
+#  endif
+#endif
@@ -0,0 +1,64 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/*------------------------------------------------------------------------------
+	parameters
+------------------------------------------------------------------------------*/
+
+/**
+ * Description:
+ * 		Base 2 logarithm of the number of elements stored in every chunk of a
+ * 		segmented container. Bigger chunks mean fewer allocations and a
+ * 		smaller directory, smaller chunks less unused memory.
+ *
+ * Expected type:
+ * 		<unsigned int> (1 to 30)
+ *
+ * Default value:
+ * 		10 (1024 elements per chunk)
+ *
+ * Examples:
+ * 		6
+ * 		12
+ * 		16
+ */
+/*
+#define C4C_PARAM_OPT_CHUNK_SHIFT
+*/
+
+/*------------------------------------------------------------------------------
+	parameters checks
+------------------------------------------------------------------------------*/
+
+#ifndef C4C_PARAM_OPT_CHUNK_SHIFT
+#  define C4C_PARAM_OPT_CHUNK_SHIFT 10
+#else
+#  if C4C_PARAM_OPT_CHUNK_SHIFT < 1 || C4C_PARAM_OPT_CHUNK_SHIFT > 30
+#    error C4C_PARAM_OPT_CHUNK_SHIFT must be between 1 and 30.
+#  endif
+#endif
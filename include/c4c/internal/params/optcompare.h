@@ -0,0 +1,67 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/*------------------------------------------------------------------------------
+	parameters
+------------------------------------------------------------------------------*/
+
+/**
+ * Description:
+ * 		The container's ordering. Must be a function-like macro (or function)
+ * 		evaluating to non-zero if its first argument goes before the second one
+ * 		(i.e. a strict weak ordering like '<').
+ * 		Being a macro, the comparison gets inlined in the generated functions.
+ * 		See the container's documentation for the type of the arguments.
+ * 		If left undefined the functions needing it won't be generated (unless
+ * 		the container specifies a default value).
+ *
+ * Expected type:
+ * 		<int (a, b)>
+ *
+ * Examples:
+ * 		C4C_LESS
+ * 		C4C_GREATER
+ * 		MY_STRUCT_LESS
+ */
+/*
+#define C4C_PARAM_OPT_COMPARE
+*/
+
+/*------------------------------------------------------------------------------
+	built-in comparisons
+------------------------------------------------------------------------------*/
+
+#ifndef C4C_LESS
+/* Ascending order (arithmetic types). */
+#  define C4C_LESS(a, b) ((a) < (b))
+#endif
+
+#ifndef C4C_GREATER
+/* Descending order (arithmetic types). */
+#  define C4C_GREATER(a, b) ((a) > (b))
+#endif
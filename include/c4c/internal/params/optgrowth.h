@@ -0,0 +1,86 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/*------------------------------------------------------------------------------
+	parameters
+------------------------------------------------------------------------------*/
+
+/**
+ * Description:
+ * 		The container's growth policy. Used every time the container has to grow
+ * 		by itself (i.e. when pushing a new element into a full container).
+ * 		Must be the name of a function-like macro (or function) taking the
+ * 		current capacity and returning the suggested new one. The container will
+ * 		always grow at least enough to store the new element(s) regardless of
+ * 		the returned value.
+ * 		Multiplicative policies (C4C_GROWTH_1_5X, C4C_GROWTH_2X) make repeated
+ * 		appends amortized O(1) at the cost of some unused memory.
+ * 		Ignored if C4C_ALLOC_STATIC has been defined.
+ *
+ * Expected type:
+ * 		<size_t (size_t capacity)>
+ *
+ * Default value:
+ * 		C4C_GROWTH_LINEAR
+ *
+ * Examples:
+ * 		C4C_GROWTH_LINEAR
+ * 		C4C_GROWTH_1_5X
+ * 		C4C_GROWTH_2X
+ * 		my_growth_fn
+ */
+/*
+#define C4C_PARAM_OPT_GROWTH
+*/
+
+/*------------------------------------------------------------------------------
+	built-in growth policies
+------------------------------------------------------------------------------*/
+
+#ifndef C4C_GROWTH_LINEAR
+/* Grow by C4C_ALLOC_DYNAMIC elements at a time. */
+#  define C4C_GROWTH_LINEAR(capacity) ((capacity) + C4C_ALLOC_DYNAMIC)
+#endif
+
+#ifndef C4C_GROWTH_1_5X
+/* Grow by half the current capacity. */
+#  define C4C_GROWTH_1_5X(capacity) ((capacity) + (capacity) / 2)
+#endif
+
+#ifndef C4C_GROWTH_2X
+/* Double the current capacity. */
+#  define C4C_GROWTH_2X(capacity) ((capacity) * 2)
+#endif
+
+/*------------------------------------------------------------------------------
+	parameters checks
+------------------------------------------------------------------------------*/
+
+#ifndef C4C_PARAM_OPT_GROWTH
+#  define C4C_PARAM_OPT_GROWTH C4C_GROWTH_LINEAR
+#endif
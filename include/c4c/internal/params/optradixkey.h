@@ -0,0 +1,66 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/*------------------------------------------------------------------------------
+	parameters
+------------------------------------------------------------------------------*/
+
+/**
+ * Description:
+ * 		Extract the radix sort key from an element. Must be a function-like
+ * 		macro (or function) evaluating to an UNSIGNED integer type. Elements
+ * 		are sorted in ascending key order.
+ * 		Signed keys can be mapped to unsigned ones by flipping their sign bit.
+ * 		If left undefined radix_sort() won't be generated.
+ *
+ * Expected type:
+ * 		<unsigned integer (element)>
+ *
+ * Examples:
+ * 		C4C_RADIX_KEY_SELF
+ * 		MY_STRUCT_ID
+ * 		C4C_RADIX_KEY_INT
+ */
+/*
+#define C4C_PARAM_OPT_RADIX_KEY
+*/
+
+/*------------------------------------------------------------------------------
+	built-in keys
+------------------------------------------------------------------------------*/
+
+#ifndef C4C_RADIX_KEY_SELF
+/* The element is the key (unsigned integer types). */
+#  define C4C_RADIX_KEY_SELF(element) (element)
+#endif
+
+#ifndef C4C_RADIX_KEY_INT
+/* The element is a signed int. */
+#  define C4C_RADIX_KEY_INT(element) \
+	((unsigned int)(element) ^ ((unsigned int)1 << (sizeof(int) * 8 - 1)))
+#endif
@@ -0,0 +1,48 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#ifndef __C4C_PREFETCH_H__
+#define __C4C_PREFETCH_H__
+
+/*
+ * Hint the CPU to start loading the cache line holding addr (read access, keep
+ * it in every cache level). addr doesn't have to be valid: a prefetch never
+ * faults. Expands to nothing on compilers without a prefetch intrinsic.
+ */
+#ifndef C4C_PREFETCH
+#  if defined(__GNUC__) || defined(__clang__)
+#    define C4C_PREFETCH(addr) __builtin_prefetch((const void*)(addr), 0, 3)
+#  elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#    include <xmmintrin.h> /* for _mm_prefetch() */
+#    define C4C_PREFETCH(addr) _mm_prefetch((const char*)(addr), _MM_HINT_T0)
+#  else
+#    define C4C_PREFETCH(addr) ((void)0)
+#  endif
+#endif
+
+#endif /* __C4C_PREFETCH_H__ */
@@ -0,0 +1,70 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/*
+ * Instruction sets available to the vectorized kernels (see simd.inl).
+ *
+ * __C4C_SIMD_SSE2: the compiler targets SSE2 (always true on x86-64), the
+ *                  kernels use it unconditionally.
+ * __C4C_SIMD_AVX2: the compiler can emit AVX2 code for single functions
+ *                  (__C4C_SIMD_AVX2_TARGET), the kernels use it only if the
+ *                  running CPU supports it.
+ *
+ * Define C4C_FEATURE_NO_SIMD before including a container to get the portable
+ * (plain loops) kernels only.
+ */
+
+#undef __C4C_SIMD_SSE2
+#undef __C4C_SIMD_AVX2
+#undef __C4C_SIMD_AVX2_TARGET
+
+#if !defined(C4C_FEATURE_NO_SIMD) && \
+	(defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define __C4C_SIMD_SSE2 1
+#  include <emmintrin.h>
+#  if defined(__clang__) || \
+	(defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#    define __C4C_SIMD_AVX2 1
+#    define __C4C_SIMD_AVX2_TARGET __attribute__((target("avx2")))
+#    include <immintrin.h>
+#  elif defined(_MSC_VER) && _MSC_VER >= 1800
+#    define __C4C_SIMD_AVX2 1
+#    define __C4C_SIMD_AVX2_TARGET
+#    include <immintrin.h>
+#    include <intrin.h> /* for __cpuid(), __cpuidex(), _xgetbv() */
+#  endif
+#endif
+
+#ifndef __C4C_SIMD_SSE2
+#  define __C4C_SIMD_SSE2 0
+#endif
+
+#ifndef __C4C_SIMD_AVX2
+#  define __C4C_SIMD_AVX2 0
+#  define __C4C_SIMD_AVX2_TARGET
+#endif
@@ -0,0 +1,445 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/*
+ * Internal vectorized kernels template for the arithmetic containers.
+ *
+ * Generates the static functions (n is the number of elements):
+ * - <prefix>_simd_find_(array, n, value)   first index of value, n if missing.
+ * - <prefix>_simd_count_(array, n, value)  occurrences of value.
+ * - <prefix>_simd_min_(array, n)           smallest element (n > 0).
+ * - <prefix>_simd_max_(array, n)           greatest element (n > 0).
+ * - <prefix>_simd_sum_(array, n)           sum of the elements (widened).
+ *
+ * __C4C_SIMD_TYPE (the element type) and __C4C_SIMD_KIND (one of the
+ * C4C_ARITH_xxx constants) must be defined before including this file and get
+ * undefined at its end.
+ * SSE2 kernels are used when the compiler targets SSE2, AVX2 ones when the
+ * running CPU supports AVX2 (detected once), plain loops otherwise. There are
+ * no vectorized min/max for 64 bit integers (neither SSE2 nor AVX2 have them).
+ * Floating point sums are computed in a different order than a plain loop
+ * would (results may differ by rounding) and the min/max of arrays containing
+ * NaNs is unspecified.
+ */
+
+#ifndef __C4C_SIMD_TYPE
+#  error __C4C_SIMD_TYPE must be defined before including simd.inl.
+#endif
+
+#ifndef __C4C_SIMD_KIND
+#  error __C4C_SIMD_KIND must be defined before including simd.inl.
+#endif
+
+#include <stdint.h>
+
+#include "c4c/internal/simd.h"
+
+#define __C4C_SIMD_NAME_(name, isa) name##isa
+#define __C4C_SIMD_NAME(name, isa) __C4C_SIMD_NAME_(name, isa)
+
+#define __C4C_SIMD_USE_SSE2 (__C4C_SIMD_SSE2 && __C4C_SIMD_KIND != C4C_ARITH_GENERIC)
+#define __C4C_SIMD_USE_AVX2 (__C4C_SIMD_AVX2 && __C4C_SIMD_KIND != C4C_ARITH_GENERIC)
+#define __C4C_SIMD_USE_MINMAX \
+	(__C4C_SIMD_KIND != C4C_ARITH_INT64 && __C4C_SIMD_KIND != C4C_ARITH_UINT64)
+
+/* Sums accumulator (wrapping unsigned math for integers) and lane types. */
+#if __C4C_SIMD_KIND == C4C_ARITH_GENERIC
+#  define __C4C_SIMD_ACC_TYPE __C4C_SIMD_TYPE
+#elif __C4C_SIMD_KIND == C4C_ARITH_FLOAT || __C4C_SIMD_KIND == C4C_ARITH_DOUBLE
+#  define __C4C_SIMD_ACC_TYPE double
+#else
+#  define __C4C_SIMD_ACC_TYPE uint64_t
+#endif
+
+#if __C4C_SIMD_KIND == C4C_ARITH_INT32 || __C4C_SIMD_KIND == C4C_ARITH_UINT32 || \
+	__C4C_SIMD_KIND == C4C_ARITH_FLOAT
+#  define __C4C_SIMD_LANE_UINT uint32_t
+#else
+#  define __C4C_SIMD_LANE_UINT uint64_t
+#endif
+
+/*------------------------------------------------------------------------------
+	scalar kernels (from index i to n)
+------------------------------------------------------------------------------*/
+
+C4C_METHOD_INLINE(size_t, simd_find_scalar_, const __C4C_SIMD_TYPE* a, size_t i, size_t n, __C4C_SIMD_TYPE value)
+{
+	for (; i < n; ++i) {
+		if (a[i] == value)
+			return i;
+	}
+	return n;
+}
+
+C4C_METHOD_INLINE(size_t, simd_count_scalar_, const __C4C_SIMD_TYPE* a, size_t i, size_t n, __C4C_SIMD_TYPE value)
+{
+	size_t count = 0;
+	for (; i < n; ++i)
+		count += a[i] == value;
+	return count;
+}
+
+C4C_METHOD_INLINE(__C4C_SIMD_TYPE, simd_min_scalar_, const __C4C_SIMD_TYPE* a, size_t i, size_t n, __C4C_SIMD_TYPE min)
+{
+	for (; i < n; ++i) {
+		if (a[i] < min)
+			min = a[i];
+	}
+	return min;
+}
+
+C4C_METHOD_INLINE(__C4C_SIMD_TYPE, simd_max_scalar_, const __C4C_SIMD_TYPE* a, size_t i, size_t n, __C4C_SIMD_TYPE max)
+{
+	for (; i < n; ++i) {
+		if (max < a[i])
+			max = a[i];
+	}
+	return max;
+}
+
+C4C_METHOD_INLINE(__C4C_SIMD_ACC_TYPE, simd_sum_scalar_, const __C4C_SIMD_TYPE* a, size_t i, size_t n, __C4C_SIMD_ACC_TYPE sum)
+{
+	for (; i < n; ++i)
+		sum += (__C4C_SIMD_ACC_TYPE)a[i];
+	return sum;
+}
+
+/*------------------------------------------------------------------------------
+	SSE2 kernels
+------------------------------------------------------------------------------*/
+
+#if __C4C_SIMD_USE_SSE2
+
+#define __C4C_SIMD_ISA sse2_
+#define __C4C_SIMD_TARGET
+#define __C4C_SIMD_BYTES 16
+
+#define _simd_cnt_t __m128i
+#define _simd_cnt_lane_t __C4C_SIMD_LANE_UINT
+#define _simd_cnt_zero_() _mm_setzero_si128()
+#define _simd_cnt_store_(p, acc) _mm_storeu_si128((__m128i*)(p), (acc))
+
+#if __C4C_SIMD_KIND == C4C_ARITH_FLOAT
+#  define _simd_vec_t __m128
+#  define _simd_load_(p) _mm_loadu_ps((const float*)(p))
+#  define _simd_store_(p, v) _mm_storeu_ps((float*)(p), (v))
+#  define _simd_set1_(x) _mm_set1_ps(x)
+#  define _simd_eq_(a, b) _mm_cmpeq_ps((a), (b))
+#  define _simd_or_(a, b) _mm_or_ps((a), (b))
+#  define _simd_movemask_(m) _mm_movemask_ps(m)
+#  define _simd_cnt_add_(acc, m) _mm_sub_epi32((acc), _mm_castps_si128(m))
+#  define _simd_min_(a, b) _mm_min_ps((a), (b))
+#  define _simd_max_(a, b) _mm_max_ps((a), (b))
+#  define _simd_acc_t __m128d
+#  define _simd_acc_zero_() _mm_setzero_pd()
+#  define _simd_acc_add_(acc, x) \
+	do { \
+		__m128 __x = (x); \
+		(acc) = _mm_add_pd((acc), _mm_cvtps_pd(__x)); \
+		(acc) = _mm_add_pd((acc), _mm_cvtps_pd(_mm_movehl_ps(__x, __x))); \
+	} while (0)
+#  define _simd_acc_store_(p, acc) _mm_storeu_pd((p), (acc))
+#elif __C4C_SIMD_KIND == C4C_ARITH_DOUBLE
+#  define _simd_vec_t __m128d
+#  define _simd_load_(p) _mm_loadu_pd((const double*)(p))
+#  define _simd_store_(p, v) _mm_storeu_pd((double*)(p), (v))
+#  define _simd_set1_(x) _mm_set1_pd(x)
+#  define _simd_eq_(a, b) _mm_cmpeq_pd((a), (b))
+#  define _simd_or_(a, b) _mm_or_pd((a), (b))
+#  define _simd_movemask_(m) _mm_movemask_pd(m)
+#  define _simd_cnt_add_(acc, m) _mm_sub_epi64((acc), _mm_castpd_si128(m))
+#  define _simd_min_(a, b) _mm_min_pd((a), (b))
+#  define _simd_max_(a, b) _mm_max_pd((a), (b))
+#  define _simd_acc_t __m128d
+#  define _simd_acc_zero_() _mm_setzero_pd()
+#  define _simd_acc_add_(acc, x) ((acc) = _mm_add_pd((acc), (x)))
+#  define _simd_acc_store_(p, acc) _mm_storeu_pd((p), (acc))
+#else
+#  define _simd_vec_t __m128i
+#  define _simd_load_(p) _mm_loadu_si128((const __m128i*)(p))
+#  define _simd_store_(p, v) _mm_storeu_si128((__m128i*)(p), (v))
+#  define _simd_or_(a, b) _mm_or_si128((a), (b))
+#  define _simd_movemask_(m) _mm_movemask_epi8(m)
+#  define _simd_acc_t __m128i
+#  define _simd_acc_zero_() _mm_setzero_si128()
+#  define _simd_acc_store_(p, acc) _mm_storeu_si128((__m128i*)(p), (acc))
+#  if __C4C_SIMD_USE_MINMAX
+#    define _simd_set1_(x) _mm_set1_epi32((int)(x))
+#    define _simd_eq_(a, b) _mm_cmpeq_epi32((a), (b))
+#    define _simd_cnt_add_(acc, m) _mm_sub_epi32((acc), (m))
+/* SSE2 has no 32 bit min/max: select with a compare mask instead. */
+#    define _simd_select_(mask, a, b) \
+	_mm_or_si128(_mm_and_si128((mask), (a)), _mm_andnot_si128((mask), (b)))
+#    if __C4C_SIMD_KIND == C4C_ARITH_INT32
+#      define _simd_gt_(a, b) _mm_cmpgt_epi32((a), (b))
+/* Sign extend to 64 bits by interleaving with the sign mask. */
+#      define _simd_acc_add_(acc, x) \
+	do { \
+		__m128i __x = (x); \
+		__m128i __h = _mm_srai_epi32(__x, 31); \
+		(acc) = _mm_add_epi64((acc), _mm_unpacklo_epi32(__x, __h)); \
+		(acc) = _mm_add_epi64((acc), _mm_unpackhi_epi32(__x, __h)); \
+	} while (0)
+#    else
+/* Unsigned compare: flip the sign bits then compare as signed. */
+#      define _simd_gt_(a, b) \
+	_mm_cmpgt_epi32(_mm_xor_si128((a), _mm_set1_epi32((int)0x80000000)), \
+		_mm_xor_si128((b), _mm_set1_epi32((int)0x80000000)))
+#      define _simd_acc_add_(acc, x) \
+	do { \
+		__m128i __x = (x); \
+		(acc) = _mm_add_epi64((acc), _mm_unpacklo_epi32(__x, _mm_setzero_si128())); \
+		(acc) = _mm_add_epi64((acc), _mm_unpackhi_epi32(__x, _mm_setzero_si128())); \
+	} while (0)
+#    endif
+#    define _simd_min_(a, b) _simd_select_(_simd_gt_((a), (b)), (b), (a))
+#    define _simd_max_(a, b) _simd_select_(_simd_gt_((a), (b)), (a), (b))
+#  else
+#    define _simd_set1_(x) _mm_set1_epi64x((int64_t)(x))
+/* SSE2 has no 64 bit compare: both 32 bit halves must match. */
+#    define _simd_eq_(a, b) \
+	_mm_and_si128(_mm_cmpeq_epi32((a), (b)), \
+		_mm_shuffle_epi32(_mm_cmpeq_epi32((a), (b)), _MM_SHUFFLE(2, 3, 0, 1)))
+#    define _simd_cnt_add_(acc, m) _mm_sub_epi64((acc), (m))
+#    define _simd_acc_add_(acc, x) ((acc) = _mm_add_epi64((acc), (x)))
+#  endif
+#endif
+
+#include "c4c/internal/simd_kernels.inl"
+
+#undef _simd_select_
+#undef _simd_gt_
+
+#endif /* __C4C_SIMD_USE_SSE2 */
+
+/*------------------------------------------------------------------------------
+	AVX2 kernels
+------------------------------------------------------------------------------*/
+
+#if __C4C_SIMD_USE_AVX2
+
+#define __C4C_SIMD_ISA avx2_
+#define __C4C_SIMD_TARGET __C4C_SIMD_AVX2_TARGET
+#define __C4C_SIMD_BYTES 32
+
+#define _simd_cnt_t __m256i
+#define _simd_cnt_lane_t __C4C_SIMD_LANE_UINT
+#define _simd_cnt_zero_() _mm256_setzero_si256()
+#define _simd_cnt_store_(p, acc) _mm256_storeu_si256((__m256i*)(p), (acc))
+
+#if __C4C_SIMD_KIND == C4C_ARITH_FLOAT
+#  define _simd_vec_t __m256
+#  define _simd_load_(p) _mm256_loadu_ps((const float*)(p))
+#  define _simd_store_(p, v) _mm256_storeu_ps((float*)(p), (v))
+#  define _simd_set1_(x) _mm256_set1_ps(x)
+#  define _simd_eq_(a, b) _mm256_cmp_ps((a), (b), _CMP_EQ_OQ)
+#  define _simd_or_(a, b) _mm256_or_ps((a), (b))
+#  define _simd_movemask_(m) _mm256_movemask_ps(m)
+#  define _simd_cnt_add_(acc, m) _mm256_sub_epi32((acc), _mm256_castps_si256(m))
+#  define _simd_min_(a, b) _mm256_min_ps((a), (b))
+#  define _simd_max_(a, b) _mm256_max_ps((a), (b))
+#  define _simd_acc_t __m256d
+#  define _simd_acc_zero_() _mm256_setzero_pd()
+#  define _simd_acc_add_(acc, x) \
+	do { \
+		__m256 __x = (x); \
+		(acc) = _mm256_add_pd((acc), _mm256_cvtps_pd(_mm256_castps256_ps128(__x))); \
+		(acc) = _mm256_add_pd((acc), _mm256_cvtps_pd(_mm256_extractf128_ps(__x, 1))); \
+	} while (0)
+#  define _simd_acc_store_(p, acc) _mm256_storeu_pd((p), (acc))
+#elif __C4C_SIMD_KIND == C4C_ARITH_DOUBLE
+#  define _simd_vec_t __m256d
+#  define _simd_load_(p) _mm256_loadu_pd((const double*)(p))
+#  define _simd_store_(p, v) _mm256_storeu_pd((double*)(p), (v))
+#  define _simd_set1_(x) _mm256_set1_pd(x)
+#  define _simd_eq_(a, b) _mm256_cmp_pd((a), (b), _CMP_EQ_OQ)
+#  define _simd_or_(a, b) _mm256_or_pd((a), (b))
+#  define _simd_movemask_(m) _mm256_movemask_pd(m)
+#  define _simd_cnt_add_(acc, m) _mm256_sub_epi64((acc), _mm256_castpd_si256(m))
+#  define _simd_min_(a, b) _mm256_min_pd((a), (b))
+#  define _simd_max_(a, b) _mm256_max_pd((a), (b))
+#  define _simd_acc_t __m256d
+#  define _simd_acc_zero_() _mm256_setzero_pd()
+#  define _simd_acc_add_(acc, x) ((acc) = _mm256_add_pd((acc), (x)))
+#  define _simd_acc_store_(p, acc) _mm256_storeu_pd((p), (acc))
+#else
+#  define _simd_vec_t __m256i
+#  define _simd_load_(p) _mm256_loadu_si256((const __m256i*)(p))
+#  define _simd_store_(p, v) _mm256_storeu_si256((__m256i*)(p), (v))
+#  define _simd_or_(a, b) _mm256_or_si256((a), (b))
+#  define _simd_movemask_(m) _mm256_movemask_epi8(m)
+#  define _simd_acc_t __m256i
+#  define _simd_acc_zero_() _mm256_setzero_si256()
+#  define _simd_acc_store_(p, acc) _mm256_storeu_si256((__m256i*)(p), (acc))
+#  if __C4C_SIMD_USE_MINMAX
+#    define _simd_set1_(x) _mm256_set1_epi32((int)(x))
+#    define _simd_eq_(a, b) _mm256_cmpeq_epi32((a), (b))
+#    define _simd_cnt_add_(acc, m) _mm256_sub_epi32((acc), (m))
+#    if __C4C_SIMD_KIND == C4C_ARITH_INT32
+#      define _simd_min_(a, b) _mm256_min_epi32((a), (b))
+#      define _simd_max_(a, b) _mm256_max_epi32((a), (b))
+#      define _simd_widen_(x) _mm256_cvtepi32_epi64(x)
+#    else
+#      define _simd_min_(a, b) _mm256_min_epu32((a), (b))
+#      define _simd_max_(a, b) _mm256_max_epu32((a), (b))
+#      define _simd_widen_(x) _mm256_cvtepu32_epi64(x)
+#    endif
+#    define _simd_acc_add_(acc, x) \
+	do { \
+		__m256i __x = (x); \
+		(acc) = _mm256_add_epi64((acc), _simd_widen_(_mm256_castsi256_si128(__x))); \
+		(acc) = _mm256_add_epi64((acc), _simd_widen_(_mm256_extracti128_si256(__x, 1))); \
+	} while (0)
+#  else
+#    define _simd_set1_(x) _mm256_set1_epi64x((int64_t)(x))
+#    define _simd_eq_(a, b) _mm256_cmpeq_epi64((a), (b))
+#    define _simd_cnt_add_(acc, m) _mm256_sub_epi64((acc), (m))
+#    define _simd_acc_add_(acc, x) ((acc) = _mm256_add_epi64((acc), (x)))
+#  endif
+#endif
+
+#include "c4c/internal/simd_kernels.inl"
+
+#undef _simd_widen_
+
+/*
+ * Test whether the running CPU (and OS) supports the requested level. The CPU
+ * is only queried the first time.
+ */
+#define _simd_level_sse2_ 1
+#define _simd_level_avx2_ 2
+
+C4C_METHOD_INLINE(int, simd_supports_, int level)
+{
+	static int detected = 0;
+	if (detected == 0) {
+#if defined(_MSC_VER) && !defined(__clang__)
+		int regs[4];
+		detected = _simd_level_sse2_;
+		__cpuid(regs, 0);
+		if (regs[0] >= 7) {
+			/* The CPU must support AVX and the OS must save the YMM registers
+			 * (OSXSAVE + XCR0) before AVX2 can be checked. */
+			__cpuid(regs, 1);
+			if ((regs[2] & (1 << 27)) && (regs[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6) {
+				__cpuidex(regs, 7, 0);
+				if (regs[1] & (1 << 5))
+					detected = _simd_level_avx2_;
+			}
+		}
+#else
+		__builtin_cpu_init();
+		detected = __builtin_cpu_supports("avx2") ? _simd_level_avx2_ : _simd_level_sse2_;
+#endif
+	}
+	return level <= detected;
+}
+
+#endif /* __C4C_SIMD_USE_AVX2 */
+
+/*------------------------------------------------------------------------------
+	dispatchers
+------------------------------------------------------------------------------*/
+
+C4C_METHOD_INLINE(size_t, simd_find_, const __C4C_SIMD_TYPE* a, size_t n, __C4C_SIMD_TYPE value)
+{
+#if __C4C_SIMD_USE_AVX2
+	if (C4C_METHOD_INLINE_CALL(simd_supports_, _simd_level_avx2_))
+		return C4C_METHOD_INLINE_CALL(simd_find_avx2_, a, n, value);
+#endif
+#if __C4C_SIMD_USE_SSE2
+	return C4C_METHOD_INLINE_CALL(simd_find_sse2_, a, n, value);
+#else
+	return C4C_METHOD_INLINE_CALL(simd_find_scalar_, a, 0, n, value);
+#endif
+}
+
+C4C_METHOD_INLINE(size_t, simd_count_, const __C4C_SIMD_TYPE* a, size_t n, __C4C_SIMD_TYPE value)
+{
+#if __C4C_SIMD_USE_AVX2
+	if (C4C_METHOD_INLINE_CALL(simd_supports_, _simd_level_avx2_))
+		return C4C_METHOD_INLINE_CALL(simd_count_avx2_, a, n, value);
+#endif
+#if __C4C_SIMD_USE_SSE2
+	return C4C_METHOD_INLINE_CALL(simd_count_sse2_, a, n, value);
+#else
+	return C4C_METHOD_INLINE_CALL(simd_count_scalar_, a, 0, n, value);
+#endif
+}
+
+C4C_METHOD_INLINE(__C4C_SIMD_TYPE, simd_min_, const __C4C_SIMD_TYPE* a, size_t n)
+{
+#if __C4C_SIMD_USE_AVX2 && __C4C_SIMD_USE_MINMAX
+	if (C4C_METHOD_INLINE_CALL(simd_supports_, _simd_level_avx2_))
+		return C4C_METHOD_INLINE_CALL(simd_min_avx2_, a, n);
+#endif
+#if __C4C_SIMD_USE_SSE2 && __C4C_SIMD_USE_MINMAX
+	return C4C_METHOD_INLINE_CALL(simd_min_sse2_, a, n);
+#else
+	return C4C_METHOD_INLINE_CALL(simd_min_scalar_, a, 1, n, a[0]);
+#endif
+}
+
+C4C_METHOD_INLINE(__C4C_SIMD_TYPE, simd_max_, const __C4C_SIMD_TYPE* a, size_t n)
+{
+#if __C4C_SIMD_USE_AVX2 && __C4C_SIMD_USE_MINMAX
+	if (C4C_METHOD_INLINE_CALL(simd_supports_, _simd_level_avx2_))
+		return C4C_METHOD_INLINE_CALL(simd_max_avx2_, a, n);
+#endif
+#if __C4C_SIMD_USE_SSE2 && __C4C_SIMD_USE_MINMAX
+	return C4C_METHOD_INLINE_CALL(simd_max_sse2_, a, n);
+#else
+	return C4C_METHOD_INLINE_CALL(simd_max_scalar_, a, 1, n, a[0]);
+#endif
+}
+
+C4C_METHOD_INLINE(__C4C_SIMD_ACC_TYPE, simd_sum_, const __C4C_SIMD_TYPE* a, size_t n)
+{
+#if __C4C_SIMD_USE_AVX2
+	if (C4C_METHOD_INLINE_CALL(simd_supports_, _simd_level_avx2_))
+		return C4C_METHOD_INLINE_CALL(simd_sum_avx2_, a, n);
+#endif
+#if __C4C_SIMD_USE_SSE2
+	return C4C_METHOD_INLINE_CALL(simd_sum_sse2_, a, n);
+#else
+	return C4C_METHOD_INLINE_CALL(simd_sum_scalar_, a, 0, n, 0);
+#endif
+}
+
+/* undef template macros */
+#undef _simd_level_sse2_
+#undef _simd_level_avx2_
+#undef __C4C_SIMD_NAME_
+#undef __C4C_SIMD_NAME
+#undef __C4C_SIMD_USE_SSE2
+#undef __C4C_SIMD_USE_AVX2
+#undef __C4C_SIMD_USE_MINMAX
+#undef __C4C_SIMD_ACC_TYPE
+#undef __C4C_SIMD_LANE_UINT
+#undef __C4C_SIMD_TYPE
+#undef __C4C_SIMD_KIND
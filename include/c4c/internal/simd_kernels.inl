@@ -0,0 +1,154 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/*
+ * Internal template included by simd.inl once per instruction set.
+ *
+ * Generates <prefix>_simd_find_<isa>, _count_<isa>, _min_<isa>, _max_<isa>
+ * and _sum_<isa> out of the width agnostic _simd_xxx_ operations defined by
+ * simd.inl (undefined at the end of this file). Leftover elements (and the
+ * whole array when it is too short) are handled by the scalar kernels.
+ */
+
+#define _simd_lanes_ (__C4C_SIMD_BYTES / sizeof(__C4C_SIMD_TYPE))
+#define _simd_acc_lanes_ (__C4C_SIMD_BYTES / sizeof(__C4C_SIMD_ACC_TYPE))
+
+__C4C_SIMD_TARGET
+C4C_METHOD_INLINE(size_t, __C4C_SIMD_NAME(simd_find_, __C4C_SIMD_ISA), const __C4C_SIMD_TYPE* a, size_t n, __C4C_SIMD_TYPE value)
+{
+	const _simd_vec_t v = _simd_set1_(value);
+	size_t i;
+	/* Test four vectors per iteration with a single branch, the scalar kernel
+	 * then finds the exact position within the block. */
+	for (i = 0; i + 4 * _simd_lanes_ <= n; i += 4 * _simd_lanes_) {
+		_simd_vec_t m = _simd_or_(
+			_simd_or_(_simd_eq_(_simd_load_(a + i), v),
+				_simd_eq_(_simd_load_(a + i + _simd_lanes_), v)),
+			_simd_or_(_simd_eq_(_simd_load_(a + i + 2 * _simd_lanes_), v),
+				_simd_eq_(_simd_load_(a + i + 3 * _simd_lanes_), v)));
+		if (_simd_movemask_(m))
+			break;
+	}
+	return C4C_METHOD_INLINE_CALL(simd_find_scalar_, a, i, n, value);
+}
+
+__C4C_SIMD_TARGET
+C4C_METHOD_INLINE(size_t, __C4C_SIMD_NAME(simd_count_, __C4C_SIMD_ISA), const __C4C_SIMD_TYPE* a, size_t n, __C4C_SIMD_TYPE value)
+{
+	const _simd_vec_t v = _simd_set1_(value);
+	_simd_cnt_lane_t lanes[_simd_lanes_];
+	_simd_cnt_t acc;
+	size_t i = 0, j, count = 0;
+	while (i + _simd_lanes_ <= n) {
+		/* Matching lanes are all ones (-1): subtracting them counts the
+		 * matches. Flush the counters long before 32 bit lanes overflow. */
+		acc = _simd_cnt_zero_();
+		for (j = 0; j < 65536 && i + _simd_lanes_ <= n; ++j, i += _simd_lanes_)
+			acc = _simd_cnt_add_(acc, _simd_eq_(_simd_load_(a + i), v));
+		_simd_cnt_store_(lanes, acc);
+		for (j = 0; j < _simd_lanes_; ++j)
+			count += (size_t)lanes[j];
+	}
+	return count + C4C_METHOD_INLINE_CALL(simd_count_scalar_, a, i, n, value);
+}
+
+#ifdef _simd_min_
+
+__C4C_SIMD_TARGET
+C4C_METHOD_INLINE(__C4C_SIMD_TYPE, __C4C_SIMD_NAME(simd_min_, __C4C_SIMD_ISA), const __C4C_SIMD_TYPE* a, size_t n)
+{
+	__C4C_SIMD_TYPE lanes[_simd_lanes_];
+	_simd_vec_t acc;
+	size_t i;
+	if (n < _simd_lanes_)
+		return C4C_METHOD_INLINE_CALL(simd_min_scalar_, a, 1, n, a[0]);
+	acc = _simd_load_(a);
+	for (i = _simd_lanes_; i + _simd_lanes_ <= n; i += _simd_lanes_)
+		acc = _simd_min_(acc, _simd_load_(a + i));
+	_simd_store_(lanes, acc);
+	return C4C_METHOD_INLINE_CALL(simd_min_scalar_, a, i, n,
+		C4C_METHOD_INLINE_CALL(simd_min_scalar_, lanes, 1, _simd_lanes_, lanes[0]));
+}
+
+__C4C_SIMD_TARGET
+C4C_METHOD_INLINE(__C4C_SIMD_TYPE, __C4C_SIMD_NAME(simd_max_, __C4C_SIMD_ISA), const __C4C_SIMD_TYPE* a, size_t n)
+{
+	__C4C_SIMD_TYPE lanes[_simd_lanes_];
+	_simd_vec_t acc;
+	size_t i;
+	if (n < _simd_lanes_)
+		return C4C_METHOD_INLINE_CALL(simd_max_scalar_, a, 1, n, a[0]);
+	acc = _simd_load_(a);
+	for (i = _simd_lanes_; i + _simd_lanes_ <= n; i += _simd_lanes_)
+		acc = _simd_max_(acc, _simd_load_(a + i));
+	_simd_store_(lanes, acc);
+	return C4C_METHOD_INLINE_CALL(simd_max_scalar_, a, i, n,
+		C4C_METHOD_INLINE_CALL(simd_max_scalar_, lanes, 1, _simd_lanes_, lanes[0]));
+}
+
+#endif /* _simd_min_ */
+
+__C4C_SIMD_TARGET
+C4C_METHOD_INLINE(__C4C_SIMD_ACC_TYPE, __C4C_SIMD_NAME(simd_sum_, __C4C_SIMD_ISA), const __C4C_SIMD_TYPE* a, size_t n)
+{
+	__C4C_SIMD_ACC_TYPE lanes[_simd_acc_lanes_];
+	__C4C_SIMD_ACC_TYPE sum = 0;
+	_simd_acc_t acc = _simd_acc_zero_();
+	size_t i, j;
+	for (i = 0; i + _simd_lanes_ <= n; i += _simd_lanes_)
+		_simd_acc_add_(acc, _simd_load_(a + i));
+	_simd_acc_store_(lanes, acc);
+	for (j = 0; j < _simd_acc_lanes_; ++j)
+		sum += lanes[j];
+	return C4C_METHOD_INLINE_CALL(simd_sum_scalar_, a, i, n, sum);
+}
+
+/* undef the instruction set operations */
+#undef _simd_lanes_
+#undef _simd_acc_lanes_
+#undef _simd_vec_t
+#undef _simd_load_
+#undef _simd_store_
+#undef _simd_set1_
+#undef _simd_eq_
+#undef _simd_or_
+#undef _simd_movemask_
+#undef _simd_cnt_t
+#undef _simd_cnt_lane_t
+#undef _simd_cnt_zero_
+#undef _simd_cnt_add_
+#undef _simd_cnt_store_
+#undef _simd_min_
+#undef _simd_max_
+#undef _simd_acc_t
+#undef _simd_acc_zero_
+#undef _simd_acc_add_
+#undef _simd_acc_store_
+#undef __C4C_SIMD_ISA
+#undef __C4C_SIMD_TARGET
+#undef __C4C_SIMD_BYTES
@@ -41,9 +41,20 @@
  * - No heap allocations/deallocations.
  * - No max capacity.
  * - Fast insertion and deletion.
+ * - Stable in place merge sort (if C4C_PARAM_OPT_COMPARE has been defined).
+ * - Prefetching traversals for long lists (c4c_list_foreach_prefetch, gather).
+ *
+ * Define C4C_FEATURE_LIST_RCU before including the container to generate
+ * add_rcu/add_tail_rcu/delete_rcu: readers walk the list with
+ * c4c_list_foreach_rcu and no lock while writers (serialized between them)
+ * modify it. Removed entries are freed after a grace period, see c4c/rcu.h.
  */
 
 #include "c4c/internal/common_headers.h"
+#include "c4c/internal/prefetch.h"
+#ifdef C4C_FEATURE_LIST_RCU
+#  include "c4c/internal/atomic.h"
+#endif
 
 #include <stddef.h> /* for size_t */
 
@@ -57,10 +68,12 @@ Parameters:
 #define C4C_PARAM_STRUCT_NAME 
 #define C4C_PARAM_PREFIX 
 #define C4C_PARAM_CONTENT 
+#define C4C_PARAM_OPT_COMPARE
 */
 
 #include "c4c/internal/params/default.h"
 #include "c4c/internal/params/content.h"
+#include "c4c/internal/params/optcompare.h"
 
 /*------------------------------------------------------------------------------
    linked list struct definition
@@ -133,6 +146,77 @@ C4C_METHOD(void, move_tail, C4C_THIS head, C4C_THIS list);
  */
 C4C_METHOD(void, splice, C4C_THIS head, C4C_THIS list);
 
+/**
+ * Collect the entries following from, up to count of them, prefetching each
+ * one. The dependent next loads are all done at once and the entries' memory
+ * is already on its way when the caller visits the batch:
+ *
+ * @code
+ * for (pos = &head; (n = my_list_gather(&head, pos, batch, 16)); pos = batch[n - 1])
+ *     for (i = 0; i < n; ++i)
+ *         visit(batch[i]);
+ * @endcode
+ *
+ * @param head     The list head.
+ * @param from     The entry to start after (head to start from the beginning).
+ * @param entries  Receives the entries.
+ * @param count    Max number of entries to collect.
+ *
+ * @return The number of collected entries. 0 if from is the last entry.
+ */
+C4C_METHOD(size_t, gather, C4C_THIS head, C4C_THIS from, C4C_THIS* entries, size_t count);
+
+#ifdef C4C_PARAM_OPT_COMPARE
+/**
+ * Sort the list in place (bottom-up merge sort: O(n log n), stable, no
+ * allocations). Only the next/prev links are changed.
+ *
+ * @note Only available if C4C_PARAM_OPT_COMPARE has been defined. The macro
+ *       receives two entries (by pointer).
+ *
+ * @param head  The list head (not sorted itself).
+ */
+C4C_METHOD(void, sort, C4C_THIS head);
+#endif
+
+#ifdef C4C_FEATURE_LIST_RCU
+/**
+ * Insert a new entry after the specified head, concurrent readers will see
+ * either the old list or the new one with a fully initialized entry.
+ *
+ * @note Only available if C4C_FEATURE_LIST_RCU has been defined.
+ * @warning Writers must be serialized (e.g. with a mutex).
+ *
+ * @param head      list Head to add it after.
+ * @param new_list  New entry to be added.
+ */
+C4C_METHOD(void, add_rcu, C4C_THIS head, C4C_THIS new_list);
+
+/**
+ * Insert a new entry before the specified head, concurrent readers will see
+ * either the old list or the new one with a fully initialized entry.
+ *
+ * @note Only available if C4C_FEATURE_LIST_RCU has been defined.
+ * @warning Writers must be serialized (e.g. with a mutex).
+ *
+ * @param head      list Head to add it before.
+ * @param new_list  New entry to be added.
+ */
+C4C_METHOD(void, add_tail_rcu, C4C_THIS head, C4C_THIS new_list);
+
+/**
+ * Deletes entry from list while concurrent readers may be walking it. The
+ * entry's next pointer is left intact so that they can move past it.
+ *
+ * @note Only available if C4C_FEATURE_LIST_RCU has been defined.
+ * @warning Writers must be serialized (e.g. with a mutex). The entry can be
+ *          freed or reused only after a grace period (c4c_rcu_synchronize).
+ *
+ * @param entry  The element to delete from the list.
+ */
+C4C_METHOD(void, delete_rcu, C4C_THIS entry);
+#endif
+
 /*------------------------------------------------------------------------------
     linked list generic functions
 ------------------------------------------------------------------------------*/
@@ -195,6 +279,67 @@ C4C_METHOD(void, splice, C4C_THIS head, C4C_THIS list);
 	for (pos = (head)->prev, n = pos->prev; pos != (head); pos = n, n = pos->prev)
 #endif
 
+#ifndef C4C_LIST_PREFETCH_DISTANCE
+/**
+ * How many entries ahead of the current one the c4c_list_foreach_prefetch
+ * macros prefetch (1 to 4). Higher values give the memory more time to
+ * answer but walk more next pointers every iteration (hopefully cached).
+ */
+#  define C4C_LIST_PREFETCH_DISTANCE 2
+#endif
+
+#ifndef __C4C_LIST_AHEAD
+#  define __C4C_LIST_AHEAD_1(pos) (pos)->next
+#  define __C4C_LIST_AHEAD_2(pos) (pos)->next->next
+#  define __C4C_LIST_AHEAD_3(pos) (pos)->next->next->next
+#  define __C4C_LIST_AHEAD_4(pos) (pos)->next->next->next->next
+#  define __C4C_LIST_AHEAD_(distance) _C4C_CONCAT(__C4C_LIST_AHEAD_, distance)
+#  define __C4C_LIST_AHEAD(pos) __C4C_LIST_AHEAD_(C4C_LIST_PREFETCH_DISTANCE)(pos)
+#endif
+
+#ifndef c4c_list_foreach_prefetch
+/**
+ * Iterate over a list prefetching the entry C4C_LIST_PREFETCH_DISTANCE
+ * positions ahead, so that its cache miss overlaps with the loop body.
+ *
+ * @param head  The head of the list.
+ * @param pos   The struct to use as a loop counter.
+ */
+#define c4c_list_foreach_prefetch(head, pos) \
+	for (pos = (head)->next; \
+	     pos != (head) && (C4C_PREFETCH(__C4C_LIST_AHEAD(pos)), 1); \
+	     pos = pos->next)
+#endif
+
+#ifndef c4c_list_foreach_prefetch_safe
+/**
+ * Iterate over a list safe against removal of list entry, prefetching the
+ * entry C4C_LIST_PREFETCH_DISTANCE positions ahead.
+ *
+ * @param head  The head of the list.
+ * @param pos   The struct to use as a loop counter.
+ * @param n     Another struct to use as temporary storage.
+ */
+#define c4c_list_foreach_prefetch_safe(head, pos, n) \
+	for (pos = (head)->next, n = pos->next; \
+	     pos != (head) && (C4C_PREFETCH(__C4C_LIST_AHEAD(pos)), 1); \
+	     pos = n, n = pos->next)
+#endif
+
+#if defined(C4C_FEATURE_LIST_RCU) && !defined(c4c_list_foreach_rcu)
+/**
+ * Iterate over a list without locks while writers use the _rcu functions.
+ * Must be inside a read section (see c4c/rcu.h).
+ *
+ * @param head  The head of the list.
+ * @param pos   The struct to use as a loop counter.
+ */
+#define c4c_list_foreach_rcu(head, pos) \
+	for (pos = __C4C_ATOMIC_LOAD_CONSUME(&(head)->next); \
+	     pos != (head); \
+	     pos = __C4C_ATOMIC_LOAD_CONSUME(&pos->next))
+#endif
+
 /*------------------------------------------------------------------------------
     undef header params
 ------------------------------------------------------------------------------*/
@@ -203,3 +348,4 @@ C4C_METHOD(void, splice, C4C_THIS head, C4C_THIS list);
 
 #include "c4c/internal/params/default_undef.h"
 #include "c4c/internal/params/content_undef.h"
+#include "c4c/internal/params/optcompare_undef.h"
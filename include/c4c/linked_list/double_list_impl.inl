@@ -31,6 +31,10 @@
  */
 
 #include "c4c/internal/common_headers.h"
+#include "c4c/internal/prefetch.h"
+#ifdef C4C_FEATURE_LIST_RCU
+#  include "c4c/internal/atomic.h"
+#endif
 
 #include <stddef.h> /* for NULL */
 
@@ -40,6 +44,7 @@
 
 #include "c4c/internal/params/default.h"
 #include "c4c/internal/params/content.h"
+#include "c4c/internal/params/optcompare.h"
 
 /*------------------------------------------------------------------------------
     linked list static functions
@@ -53,10 +58,12 @@
  */
 #define _list_add_(new_list, prev_one, next_one) \
 	do { \
-		next_one->prev = new_list; \
-		new_list->next = next_one; \
-		new_list->prev = prev_one; \
-		prev_one->next = new_list; \
+		C4C_THIS prev_ = (prev_one); \
+		C4C_THIS next_ = (next_one); \
+		next_->prev = new_list; \
+		new_list->next = next_; \
+		new_list->prev = prev_; \
+		prev_->next = new_list; \
 	} while (0)
 
 /*
@@ -83,6 +90,32 @@
 		at->prev = last; \
 	} while (0)
 
+#ifdef C4C_PARAM_OPT_COMPARE
+/*
+ * Merge two sorted NULL terminated lists (linked through next only). On ties
+ * the entries of a go first: a must hold the older entries to keep the sort
+ * stable.
+ */
+C4C_METHOD_INLINE(C4C_THIS, merge_, C4C_THIS a, C4C_THIS b)
+{
+	C4C_THIS result;
+	C4C_THIS* tail = &result;
+	while (a && b) {
+		if (C4C_PARAM_OPT_COMPARE(b, a)) {
+			*tail = b;
+			tail = &b->next;
+			b = b->next;
+		} else {
+			*tail = a;
+			tail = &a->next;
+			a = a->next;
+		}
+	}
+	*tail = a ? a : b;
+	return result;
+}
+#endif
+
 /*------------------------------------------------------------------------------
     linked list functions implementation
 ------------------------------------------------------------------------------*/
@@ -128,10 +161,96 @@ C4C_METHOD(void, splice, C4C_THIS head, C4C_THIS list)
 		_list_splice_(list, head);
 }
 
+#ifdef C4C_FEATURE_LIST_RCU
+/* Store a next pointer that readers may be loading right now. */
+#define _list_publish_(next_ptr, entry) \
+	__C4C_ATOMIC_STORE_RELEASE((C4C_THIS volatile*)(next_ptr), entry)
+
+C4C_METHOD(void, add_rcu, C4C_THIS head, C4C_THIS new_list)
+{
+	C4C_THIS next = head->next;
+	new_list->next = next;
+	new_list->prev = head;
+	next->prev = new_list;
+	_list_publish_(&head->next, new_list);
+}
+
+C4C_METHOD(void, add_tail_rcu, C4C_THIS head, C4C_THIS new_list)
+{
+	C4C_THIS prev = head->prev;
+	new_list->next = head;
+	new_list->prev = prev;
+	_list_publish_(&prev->next, new_list);
+	head->prev = new_list;
+}
+
+C4C_METHOD(void, delete_rcu, C4C_THIS entry)
+{
+	entry->next->prev = entry->prev;
+	_list_publish_(&entry->prev->next, entry->next);
+	entry->prev = NULL;
+}
+#endif
+
+C4C_METHOD(size_t, gather, C4C_THIS head, C4C_THIS from, C4C_THIS* entries, size_t count)
+{
+	size_t i;
+	C4C_THIS pos = from->next;
+	for (i = 0; i < count && pos != head; ++i) {
+		C4C_PREFETCH(pos);
+		entries[i] = pos;
+		pos = pos->next;
+	}
+	return i;
+}
+
+#ifdef C4C_PARAM_OPT_COMPARE
+C4C_METHOD(void, sort, C4C_THIS head)
+{
+	/* bins[i] is either empty or a sorted run of 2^i entries. */
+	C4C_THIS bins[sizeof(size_t) * 8];
+	C4C_THIS list;
+	C4C_THIS run;
+	C4C_THIS prev;
+	size_t i, used = 0;
+	if (head->next == head->prev)
+		return;
+	head->prev->next = NULL;
+	list = head->next;
+	while (list) {
+		run = list;
+		list = list->next;
+		run->next = NULL;
+		/* Carry the run up like a binary counter increment. */
+		for (i = 0; i < used && bins[i]; ++i) {
+			run = C4C_METHOD_INLINE_CALL(merge_, bins[i], run);
+			bins[i] = NULL;
+		}
+		if (i == used)
+			++used;
+		bins[i] = run;
+	}
+	/* Higher bins hold older entries. */
+	run = NULL;
+	for (i = 0; i < used; ++i) {
+		if (bins[i])
+			run = C4C_METHOD_INLINE_CALL(merge_, bins[i], run);
+	}
+	/* Restore the prev links and close the circle. */
+	for (prev = head; run; prev = run, run = run->next) {
+		prev->next = run;
+		run->prev = prev;
+	}
+	prev->next = head;
+	head->prev = prev;
+}
+#endif
+
 /* undef static functions macros */
 #undef _list_add_
 #undef _list_delete_
 #undef _list_splice_
+#undef _list_publish_
 
 /*------------------------------------------------------------------------------
 	undef header params
@@ -141,3 +260,4 @@ C4C_METHOD(void, splice, C4C_THIS head, C4C_THIS list)
 
 #include "c4c/internal/params/default_undef.h"
 #include "c4c/internal/params/content_undef.h"
+#include "c4c/internal/params/optcompare_undef.h"
@@ -0,0 +1,216 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/**
+ * Container:
+ * 		Hash list (double linked list with a single pointer head).
+ *
+ * Brief description:
+ * 		Heavily inspired by Linux's hlist. Declares two types:
+ * 		C4C_PARAM_STRUCT_NAME, the node (C4C_PARAM_CONTENT plus next/pprev),
+ * 		and C4C_PARAM_STRUCT_NAME_head, the list itself made of a single
+ * 		pointer. Nodes point back to the previous node's next pointer (or to the
+ * 		head's first pointer) so they can still be deleted in O(1) without
+ * 		knowing the head. Use it for hash table buckets: the bucket array is
+ * 		half the size of an array of double_list heads.
+ *
+ * Supports allocators: NO
+ * Container type:      DOUBLE LINKED LIST
+ *
+ * Features:
+ * - Sequential access (forward only, the list isn't circular).
+ * - No heap allocations/deallocations.
+ * - No max capacity.
+ * - Fast insertion and deletion.
+ * - One pointer per head.
+ */
+
+#include "c4c/internal/common_headers.h"
+
+#include <stddef.h> /* for NULL */
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+/*
+Parameters:
+
+#define C4C_PARAM_STRUCT_NAME 
+#define C4C_PARAM_PREFIX 
+#define C4C_PARAM_CONTENT 
+*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/content.h"
+
+#define __C4C_HLIST_HEAD_(name) _C4C_CONCAT(name, _head)
+#define __C4C_HLIST_HEAD __C4C_HLIST_HEAD_(C4C_PARAM_STRUCT_NAME)
+#define __C4C_HLIST_HEAD_THIS C4C_STRUCT_DECLARE(__C4C_HLIST_HEAD)*
+
+/*------------------------------------------------------------------------------
+   linked list structs definition
+------------------------------------------------------------------------------*/
+
+C4C_STRUCT_BEGIN(C4C_PARAM_STRUCT_NAME)
+	C4C_PARAM_CONTENT
+	struct C4C_PARAM_STRUCT_NAME* next;
+	struct C4C_PARAM_STRUCT_NAME** pprev;
+C4C_STRUCT_END(C4C_PARAM_STRUCT_NAME)
+
+C4C_STRUCT_BEGIN(__C4C_HLIST_HEAD)
+	struct C4C_PARAM_STRUCT_NAME* first;
+C4C_STRUCT_END(__C4C_HLIST_HEAD)
+
+/*------------------------------------------------------------------------------
+    linked list functions
+------------------------------------------------------------------------------*/
+
+/**
+ * Prepare the list for usage.
+ *
+ * @note A zero filled head (e.g. a calloc'd bucket array) is already a valid
+ *       empty list.
+ *
+ * @param head  The list head.
+ */
+C4C_METHOD(void, init, __C4C_HLIST_HEAD_THIS head);
+
+/**
+ * Prepare a node for usage (unhashed, see c4c_hlist_is_unhashed).
+ *
+ * @param node  The node.
+ */
+C4C_METHOD(void, init_node, C4C_THIS node);
+
+/**
+ * Insert a new entry at the beginning of the list.
+ *
+ * @param head  The list head.
+ * @param node  New entry to be added.
+ */
+C4C_METHOD(void, add_head, __C4C_HLIST_HEAD_THIS head, C4C_THIS node);
+
+/**
+ * Insert a new entry before the specified one.
+ *
+ * @param next  Entry already in a list to add it before.
+ * @param node  New entry to be added.
+ */
+C4C_METHOD(void, add_before, C4C_THIS next, C4C_THIS node);
+
+/**
+ * Insert a new entry after the specified one.
+ *
+ * @param prev  Entry already in a list to add it after.
+ * @param node  New entry to be added.
+ */
+C4C_METHOD(void, add_behind, C4C_THIS prev, C4C_THIS node);
+
+/**
+ * Deletes entry from list.
+ *
+ * @param entry  The element to delete from the list.
+ *
+ * @warning c4c_hlist_is_unhashed on entry returns true after this (next and
+ *          pprev are set to NULL), deleting it again is undefined.
+ */
+C4C_METHOD(void, delete, C4C_THIS entry);
+
+/**
+ * Move a list from one head to another.
+ *
+ * @param old_head  The head to move the entries from. Left empty.
+ * @param new_head  The head to move the entries to. Its entries, if any, are
+ *                  dropped.
+ */
+C4C_METHOD(void, move_list, __C4C_HLIST_HEAD_THIS old_head, __C4C_HLIST_HEAD_THIS new_head);
+
+/*------------------------------------------------------------------------------
+    linked list generic functions
+------------------------------------------------------------------------------*/
+
+#ifndef c4c_hlist_is_empty
+/**
+ * Test whether a list is empty.
+ *
+ * @param head  The list head to test.
+ *
+ * @return 1 if the list is empty. 0 otherwise.
+ */
+#define c4c_hlist_is_empty(head) \
+	((head)->first == NULL)
+#endif
+
+#ifndef c4c_hlist_is_unhashed
+/**
+ * Test whether a node is in a list.
+ *
+ * @param node  The node to test.
+ *
+ * @return 1 if the node is not in any list. 0 otherwise.
+ */
+#define c4c_hlist_is_unhashed(node) \
+	((node)->pprev == NULL)
+#endif
+
+#ifndef c4c_hlist_foreach
+/**
+ * Iterate over a list.
+ *
+ * @param head  The list head.
+ * @param pos   The struct to use as a loop counter.
+ */
+#define c4c_hlist_foreach(head, pos) \
+	for (pos = (head)->first; pos; pos = pos->next)
+#endif
+
+#ifndef c4c_hlist_foreach_safe
+/**
+ * Iterate over a list safe against removal of list entry.
+ *
+ * @param head  The list head.
+ * @param pos   The struct to use as a loop counter.
+ * @param n     Another struct to use as temporary storage.
+ */
+#define c4c_hlist_foreach_safe(head, pos, n) \
+	for (pos = (head)->first; pos && ((n = pos->next), 1); pos = n)
+#endif
+
+/*------------------------------------------------------------------------------
+    undef header params
+------------------------------------------------------------------------------*/
+
+#undef __C4C_HLIST_HEAD_
+#undef __C4C_HLIST_HEAD
+#undef __C4C_HLIST_HEAD_THIS
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/content_undef.h"
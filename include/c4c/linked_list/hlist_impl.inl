@@ -0,0 +1,119 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/*
+ * This header has been heavily inspired by linux's hlist
+ */
+
+#include "c4c/internal/common_headers.h"
+
+#include <stddef.h> /* for NULL */
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/content.h"
+
+#define __C4C_HLIST_HEAD_(name) _C4C_CONCAT(name, _head)
+#define __C4C_HLIST_HEAD __C4C_HLIST_HEAD_(C4C_PARAM_STRUCT_NAME)
+#define __C4C_HLIST_HEAD_THIS C4C_STRUCT_DECLARE(__C4C_HLIST_HEAD)*
+
+/*------------------------------------------------------------------------------
+    linked list functions implementation
+------------------------------------------------------------------------------*/
+
+C4C_METHOD(void, init, __C4C_HLIST_HEAD_THIS head)
+{
+	head->first = NULL;
+}
+
+C4C_METHOD(void, init_node, C4C_THIS node)
+{
+	node->next = NULL;
+	node->pprev = NULL;
+}
+
+C4C_METHOD(void, add_head, __C4C_HLIST_HEAD_THIS head, C4C_THIS node)
+{
+	C4C_THIS first = head->first;
+	node->next = first;
+	if (first)
+		first->pprev = &node->next;
+	head->first = node;
+	node->pprev = &head->first;
+}
+
+C4C_METHOD(void, add_before, C4C_THIS next, C4C_THIS node)
+{
+	node->pprev = next->pprev;
+	node->next = next;
+	next->pprev = &node->next;
+	*node->pprev = node;
+}
+
+C4C_METHOD(void, add_behind, C4C_THIS prev, C4C_THIS node)
+{
+	node->next = prev->next;
+	prev->next = node;
+	node->pprev = &prev->next;
+	if (node->next)
+		node->next->pprev = &node->next;
+}
+
+C4C_METHOD(void, delete, C4C_THIS entry)
+{
+	C4C_THIS next = entry->next;
+	*entry->pprev = next;
+	if (next)
+		next->pprev = entry->pprev;
+	entry->next = NULL;
+	entry->pprev = NULL;
+}
+
+C4C_METHOD(void, move_list, __C4C_HLIST_HEAD_THIS old_head, __C4C_HLIST_HEAD_THIS new_head)
+{
+	new_head->first = old_head->first;
+	if (new_head->first)
+		new_head->first->pprev = &new_head->first;
+	old_head->first = NULL;
+}
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#undef __C4C_HLIST_HEAD_
+#undef __C4C_HLIST_HEAD
+#undef __C4C_HLIST_HEAD_THIS
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/content_undef.h"
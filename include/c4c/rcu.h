@@ -0,0 +1,161 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#ifndef __C4C_RCU_H__
+#define __C4C_RCU_H__
+
+/**
+ * Epoch based grace periods for the containers' RCU APIs (e.g. the double
+ * list's add_rcu/delete_rcu/c4c_list_foreach_rcu).
+ *
+ * Readers never write shared memory but their own c4c_rcu_reader_t, so they
+ * don't bounce cache lines between each other. Writers (serialized by a lock
+ * of your choice) unlink entries, call c4c_rcu_synchronize() and then free
+ * the unlinked entries: every reader that could still see them is done.
+ *
+ * @code
+ * reader thread:                       writer thread:
+ * c4c_rcu_read_lock(&me);              lock(&writers);
+ * c4c_list_foreach_rcu(&head, pos)     my_list_delete_rcu(entry);
+ *     use(pos);                        unlock(&writers);
+ * c4c_rcu_read_unlock(&me);            c4c_rcu_synchronize(&rcu);
+ *                                      free(entry);
+ * @endcode
+ *
+ * @note Read sections can't be nested and a reader must not wait for a grace
+ *       period (deadlock).
+ */
+
+#include "c4c/config.h"
+#include "c4c/internal/function.h"
+#include "c4c/internal/atomic.h"
+
+#include <stddef.h> /* for size_t, NULL */
+
+/*------------------------------------------------------------------------------
+	rcu structs definition
+------------------------------------------------------------------------------*/
+
+/* One per reader thread. */
+typedef struct c4c_rcu_reader_t {
+	/* Epoch at read_lock() time, 0 outside of the read sections. */
+	volatile size_t epoch;
+	struct c4c_rcu_reader_t* next;
+} c4c_rcu_reader_t;
+
+/* One per protected structure (or group of structures). */
+typedef struct {
+	volatile size_t epoch;
+	c4c_rcu_reader_t* volatile readers;
+} c4c_rcu_t;
+
+/*------------------------------------------------------------------------------
+	rcu functions
+------------------------------------------------------------------------------*/
+
+/**
+ * Prepare the rcu domain for usage.
+ *
+ * @warning Not thread safe.
+ *
+ * @param rcu  The rcu domain.
+ */
+C4C_FUNCTION_INLINE(void, c4c_rcu_init, c4c_rcu_t* rcu)
+{
+	rcu->epoch = 1;
+	rcu->readers = NULL;
+}
+
+/**
+ * Add a reader to the rcu domain. Must be done once per reader thread before
+ * its first read section.
+ *
+ * @note Thread safe.
+ * @warning Readers can't be removed: reader must live as long as rcu.
+ *
+ * @param rcu     The rcu domain.
+ * @param reader  The reader to add.
+ */
+C4C_FUNCTION_INLINE(void, c4c_rcu_register, c4c_rcu_t* rcu, c4c_rcu_reader_t* reader)
+{
+	c4c_rcu_reader_t* first;
+	reader->epoch = 0;
+	do {
+		first = __C4C_ATOMIC_LOAD_ACQUIRE(&rcu->readers);
+		reader->next = first;
+	} while (!__C4C_ATOMIC_CAS_PTR(&rcu->readers, first, reader));
+}
+
+/**
+ * Enter a read section: entries reachable from now on won't be freed before
+ * the matching c4c_rcu_read_unlock().
+ *
+ * @param rcu     The rcu domain.
+ * @param reader  The calling thread's reader.
+ */
+C4C_FUNCTION_INLINE(void, c4c_rcu_read_lock, c4c_rcu_t* rcu, c4c_rcu_reader_t* reader)
+{
+	__C4C_ATOMIC_STORE_RELAXED(&reader->epoch, __C4C_ATOMIC_LOAD_ACQUIRE(&rcu->epoch));
+	/* Publish the epoch before reading the protected structure. */
+	__C4C_ATOMIC_FENCE();
+}
+
+/**
+ * Leave a read section. The entries read inside it must not be used anymore.
+ *
+ * @param reader  The calling thread's reader.
+ */
+C4C_FUNCTION_INLINE(void, c4c_rcu_read_unlock, c4c_rcu_reader_t* reader)
+{
+	__C4C_ATOMIC_STORE_RELEASE(&reader->epoch, 0);
+}
+
+/**
+ * Wait for a grace period: every read section started before this call is
+ * over when it returns, so the entries unlinked before the call can be freed.
+ *
+ * @note Busy waits. Unlink as many entries as possible before waiting once.
+ *
+ * @param rcu  The rcu domain.
+ */
+C4C_FUNCTION_INLINE(void, c4c_rcu_synchronize, c4c_rcu_t* rcu)
+{
+	c4c_rcu_reader_t* reader;
+	size_t epoch;
+	size_t target;
+	/* Readers seeing the new epoch also see the previous unlinks. */
+	__C4C_ATOMIC_FENCE();
+	target = __C4C_ATOMIC_FETCH_ADD_SIZE(&rcu->epoch, 1) + 1;
+	for (reader = __C4C_ATOMIC_LOAD_ACQUIRE(&rcu->readers); reader; reader = reader->next) {
+		do {
+			epoch = __C4C_ATOMIC_LOAD_ACQUIRE(&reader->epoch);
+		} while (epoch != 0 && epoch < target);
+	}
+}
+
+#endif /* __C4C_RCU_H__ */
@@ -0,0 +1,247 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/**
+ * Container:
+ * 		Dynamic LIFO stack.
+ *
+ * Brief description:
+ * 		LIFO stack (same interface as lifo_decl.inl) that grows on the heap as
+ * 		needed and gives memory back when it empties.
+ *
+ * Supports allocators: YES
+ * Container type:      DYNAMIC
+ *
+ * Features:
+ * - No max capacity: grows following C4C_PARAM_OPT_GROWTH (2X by default).
+ * - reserve() to pre-allocate (and never shrink below) a given capacity.
+ * - Shrinks by half when it becomes 1/4 full: the hysteresis keeps push/pop
+ *   sequences around a boundary from reallocating every time.
+ * - O(1) clear.
+ *
+ * Define C4C_FEATURE_STACK_SCRUB before including the container to overwrite
+ * the slots released by pop() (with C4C_PARAM_OPT_NO_VALUE) and clear() (with
+ * zeros).
+ */
+
+#include "c4c/internal/allocators_decl.h"
+#include "c4c/internal/common_headers.h"
+
+#ifdef C4C_ALLOC_STATIC
+#  error Use lifo_decl.inl for a static LIFO stack: C4C_ALLOC_STATIC is not supported.
+#endif
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+/*
+Parameters:
+
+#define C4C_PARAM_STRUCT_NAME 
+#define C4C_PARAM_PREFIX 
+#define C4C_PARAM_CONTENT_TYPE 
+#define C4C_PARAM_OPT_NO_VALUE
+#define C4C_PARAM_OPT_GROWTH
+*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/contenttype.h"
+#include "c4c/internal/params/optnovalue.h"
+
+#ifndef C4C_PARAM_OPT_GROWTH
+#  define C4C_PARAM_OPT_GROWTH C4C_GROWTH_2X
+#endif
+#include "c4c/internal/params/optgrowth.h"
+
+/*------------------------------------------------------------------------------
+   stack struct definition
+------------------------------------------------------------------------------*/
+
+C4C_STRUCT_BEGIN(C4C_PARAM_STRUCT_NAME)
+	size_t count;
+	size_t capacity;
+	size_t min_capacity;
+	C4C_PARAM_CONTENT_TYPE* elements;
+C4C_STRUCT_END(C4C_PARAM_STRUCT_NAME)
+
+/*------------------------------------------------------------------------------
+    stack functions
+------------------------------------------------------------------------------*/
+
+/**
+ * Initialize a new dynamic LIFO stack.
+ *
+ * @param stack     The LIFO stack.
+ * @param capacity  The initial capacity, the stack never shrinks below it.
+ *                  Can be zero: memory is allocated upon insertion.
+ *
+ * @retval C4CE_MALLOC_FAIL  C4C_ALLOC() failed.
+ * @retval C4CE_SUCCESS      Success.
+ */
+C4C_METHOD(c4c_res_t, init, C4C_THIS stack, size_t capacity);
+
+/**
+ * Free the stack's memory and prepare for new usage (must re-initialize
+ * first).
+ *
+ * @param stack  The LIFO stack.
+ */
+C4C_METHOD(void, free, C4C_THIS stack);
+
+/**
+ * Make sure the stack can hold at least the specified number of elements
+ * without further reallocations. The stack will never shrink below this
+ * capacity afterwards.
+ *
+ * @param stack     The LIFO stack.
+ * @param capacity  The minimum capacity.
+ *
+ * @retval C4CE_REALLOC_FAIL  Memory reallocation failed. The stack is left
+ *                            untouched.
+ * @retval C4CE_SUCCESS       Success.
+ * @retval C4CEW_NOTHING      The stack can already hold capacity elements.
+ */
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS stack, size_t capacity);
+
+/**
+ * Clear the stack and prepare for new usage. The capacity is left untouched.
+ *
+ * @note O(1) unless C4C_FEATURE_STACK_SCRUB is defined (O(count) then).
+ *
+ * @warning Does NOT free the stack elements.
+ *
+ * @param stack  The LIFO stack.
+ */
+C4C_METHOD(void, clear, C4C_THIS stack);
+
+/**
+ * Insert a new value at the end of the stack.
+ *
+ * @note If the stack is full it will grow following C4C_PARAM_OPT_GROWTH.
+ *
+ * @param stack        The LIFO stack.
+ * @param new_element  The element to add.
+ *
+ * @retval C4CE_REALLOC_FAIL  Memory reallocation failed. The stack is left
+ *                            untouched.
+ * @retval C4CE_SUCCESS       Success.
+ */
+C4C_METHOD(c4c_res_t, push, C4C_THIS stack, C4C_PARAM_CONTENT_TYPE new_element);
+
+/**
+ * Insert n values at the end of the stack growing it (at most) once and with a
+ * single copy. src[n - 1] ends up at the top of the stack.
+ *
+ * @warning src must not point inside the stack itself.
+ *
+ * @param stack  The LIFO stack.
+ * @param src    The values to add.
+ * @param n      The number of values to add.
+ *
+ * @retval C4CE_REALLOC_FAIL  Memory reallocation failed. The stack is left
+ *                            untouched.
+ * @retval C4CE_SUCCESS       Success.
+ * @retval C4CEW_NOTHING      n is zero.
+ */
+C4C_METHOD(c4c_res_t, push_n, C4C_THIS stack, const C4C_PARAM_CONTENT_TYPE* src, size_t n);
+
+/**
+ * Insert a new uninitialized value at the end of the stack and return a pointer
+ * to it so that it can be constructed in place (no copies).
+ *
+ * @warning The pointer is invalidated by the next push/pop.
+ *
+ * @param stack  The LIFO stack.
+ *
+ * @return The new element. NULL if the stack couldn't grow.
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, emplace, C4C_THIS stack);
+
+/**
+ * Remove the value at the top of the stack and return it.
+ *
+ * @note The stack shrinks by half when it becomes 1/4 full (never below the
+ *       initial/reserved capacity). A failed shrink is ignored.
+ *
+ * @param stack  The LIFO stack.
+ *
+ * @return The element at the top of the stack. C4C_PARAM_OPT_NO_VALUE if the stack
+ *         is empty.
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE, pop, C4C_THIS stack);
+
+/**
+ * Remove up to n values from the top of the stack with a single copy.
+ *
+ * @note The values are stored in push order: dst[0] is the deepest one and
+ *       dst[count - 1] the one pop() would have returned first, so push_n()
+ *       with the same array restores the stack.
+ *
+ * @note Shrinks like pop().
+ *
+ * @param stack  The LIFO stack.
+ * @param dst    Receives the removed values (room for n values).
+ * @param n      The maximum number of values to remove.
+ *
+ * @return The number of removed values (less than n if the stack holds fewer
+ *         values).
+ */
+C4C_METHOD(size_t, pop_n, C4C_THIS stack, C4C_PARAM_CONTENT_TYPE* dst, size_t n);
+
+/**
+ * Get the value at the top of the stack without removing it.
+ *
+ * @param stack  The LIFO stack.
+ *
+ * @return The element at the top of the stack. NULL if the stack is empty.
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, top, C4C_THIS stack);
+
+/**
+ * Get the invalid value for this stack.
+ *
+ * @return A value that signals when the stack is empty.
+ */
+C4C_METHOD_INLINE(C4C_PARAM_CONTENT_TYPE, null_val, void)
+{
+	return (C4C_PARAM_CONTENT_TYPE)C4C_PARAM_OPT_NO_VALUE;
+}
+
+/*------------------------------------------------------------------------------
+    undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/contenttype_undef.h"
+#include "c4c/internal/params/optnovalue_undef.h"
+#include "c4c/internal/params/optgrowth_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
@@ -0,0 +1,217 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include "c4c/internal/allocators_impl.h"
+#include "c4c/internal/common_headers.h"
+
+#include <string.h> /* for memcpy(), memset() */
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/contenttype.h"
+#include "c4c/internal/params/optnovalue.h"
+
+#ifndef C4C_PARAM_OPT_GROWTH
+#  define C4C_PARAM_OPT_GROWTH C4C_GROWTH_2X
+#endif
+#include "c4c/internal/params/optgrowth.h"
+
+/*------------------------------------------------------------------------------
+    stack static functions
+------------------------------------------------------------------------------*/
+
+C4C_METHOD_INLINE(c4c_res_t, resize_, C4C_THIS stack, size_t capacity)
+{
+	C4C_PARAM_CONTENT_TYPE* elements;
+	elements = C4C_REALLOC(stack->elements, sizeof(C4C_PARAM_CONTENT_TYPE) * capacity);
+	if (!elements)
+		return C4CE_REALLOC_FAIL;
+	stack->elements = elements;
+	stack->capacity = capacity;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD_INLINE(c4c_res_t, grow_, C4C_THIS stack, size_t required)
+{
+	size_t capacity;
+	if (required <= stack->capacity)
+		return C4CE_SUCCESS;
+	capacity = (size_t)C4C_PARAM_OPT_GROWTH(stack->capacity);
+	if (capacity < required)
+		capacity = required;
+	return C4C_METHOD_INLINE_CALL(resize_, stack, capacity);
+}
+
+/* Shrink at 1/4 to 1/2: the next push/pop can't reallocate again. */
+C4C_METHOD_INLINE(void, shrink_, C4C_THIS stack)
+{
+	size_t capacity;
+	if (stack->count > stack->capacity / 4)
+		return;
+	capacity = stack->capacity / 2;
+	if (capacity < stack->min_capacity)
+		capacity = stack->min_capacity;
+	if (capacity != 0 && capacity < stack->capacity)
+		C4C_METHOD_INLINE_CALL(resize_, stack, capacity);
+}
+
+/*------------------------------------------------------------------------------
+    stack functions implementation
+------------------------------------------------------------------------------*/
+
+C4C_METHOD(c4c_res_t, init, C4C_THIS stack, size_t capacity)
+{
+	stack->count = 0;
+	stack->capacity = 0;
+	stack->min_capacity = capacity;
+	stack->elements = NULL;
+	if (capacity == 0)
+		return C4CE_SUCCESS;
+	stack->elements = C4C_ALLOC(sizeof(C4C_PARAM_CONTENT_TYPE) * capacity);
+	if (!stack->elements) {
+		stack->min_capacity = 0;
+		return C4CE_MALLOC_FAIL;
+	}
+	stack->capacity = capacity;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(void, free, C4C_THIS stack)
+{
+	C4C_FREE(stack->elements);
+	stack->count = 0;
+	stack->capacity = 0;
+	stack->min_capacity = 0;
+	stack->elements = NULL;
+}
+
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS stack, size_t capacity)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (capacity > stack->min_capacity)
+		stack->min_capacity = capacity;
+	if (capacity <= stack->capacity)
+		return C4CEW_NOTHING;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(resize_, stack, capacity)))
+		return err;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(void, clear, C4C_THIS stack)
+{
+#ifdef C4C_FEATURE_STACK_SCRUB
+	/* Popped slots have already been scrubbed by pop(). */
+	if (stack->count != 0)
+		memset(stack->elements, 0, sizeof(C4C_PARAM_CONTENT_TYPE) * stack->count);
+#endif
+	stack->count = 0;
+}
+
+C4C_METHOD(c4c_res_t, push, C4C_THIS stack, C4C_PARAM_CONTENT_TYPE new_element)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, stack, stack->count + 1)))
+		return err;
+	stack->elements[stack->count] = new_element;
+	++stack->count;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, push_n, C4C_THIS stack, const C4C_PARAM_CONTENT_TYPE* src, size_t n)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (n == 0)
+		return C4CEW_NOTHING;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, stack, stack->count + n)))
+		return err;
+	memcpy(stack->elements + stack->count, src, sizeof(C4C_PARAM_CONTENT_TYPE) * n);
+	stack->count += n;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, emplace, C4C_THIS stack)
+{
+	if (!c4c_succeeded(C4C_METHOD_INLINE_CALL(grow_, stack, stack->count + 1)))
+		return NULL;
+	++stack->count;
+	return stack->elements + (stack->count - 1);
+}
+
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE, pop, C4C_THIS stack)
+{
+	C4C_PARAM_CONTENT_TYPE bottom;
+	if (stack->count == 0)
+		return (C4C_PARAM_CONTENT_TYPE)C4C_PARAM_OPT_NO_VALUE;
+	--stack->count;
+	bottom = stack->elements[stack->count];
+#ifdef C4C_FEATURE_STACK_SCRUB
+	stack->elements[stack->count] = (C4C_PARAM_CONTENT_TYPE)C4C_PARAM_OPT_NO_VALUE;
+#endif
+	C4C_METHOD_INLINE_CALL(shrink_, stack);
+	return bottom;
+}
+
+C4C_METHOD(size_t, pop_n, C4C_THIS stack, C4C_PARAM_CONTENT_TYPE* dst, size_t n)
+{
+#ifdef C4C_FEATURE_STACK_SCRUB
+	size_t i;
+#endif
+	if (n > stack->count)
+		n = stack->count;
+	if (n == 0)
+		return 0;
+	stack->count -= n;
+	memcpy(dst, stack->elements + stack->count, sizeof(C4C_PARAM_CONTENT_TYPE) * n);
+#ifdef C4C_FEATURE_STACK_SCRUB
+	for (i = stack->count; i < stack->count + n; ++i)
+		stack->elements[i] = (C4C_PARAM_CONTENT_TYPE)C4C_PARAM_OPT_NO_VALUE;
+#endif
+	C4C_METHOD_INLINE_CALL(shrink_, stack);
+	return n;
+}
+
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, top, C4C_THIS stack)
+{
+	return stack->count != 0 ? stack->elements + (stack->count - 1) : NULL;
+}
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/contenttype_undef.h"
+#include "c4c/internal/params/optnovalue_undef.h"
+#include "c4c/internal/params/optgrowth_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
@@ -40,6 +40,11 @@
  * - Very lightweight and fast with a minimal yet expandable interface.
  * - Fixed push/pop.
  * - LIFO stack.
+ * - O(1) clear.
+ *
+ * Define C4C_FEATURE_STACK_SCRUB before including the container to overwrite
+ * the slots released by pop() (with C4C_PARAM_OPT_NO_VALUE) and clear() (with
+ * zeros), e.g. so that no stale copies of sensitive data are left behind.
  */
 
 #include "c4c/internal/common_headers.h"
@@ -79,6 +84,8 @@ C4C_STRUCT_END(C4C_PARAM_STRUCT_NAME)
 /**
  * Clear the stack and prepare for new usage.
  *
+ * @note O(1) unless C4C_FEATURE_STACK_SCRUB is defined (O(count) then).
+ *
  * @warning Does NOT free the stack elements.
  *
  * @param stack  The LIFO stack.
@@ -96,6 +103,31 @@ C4C_METHOD(void, clear, C4C_THIS stack);
  */
 C4C_METHOD(c4c_res_t, push, C4C_THIS stack, C4C_PARAM_CONTENT_TYPE new_element);
 
+/**
+ * Insert n values at the end of the stack with a single bounds check and copy.
+ * src[n - 1] ends up at the top of the stack.
+ *
+ * @param stack  The LIFO stack.
+ * @param src    The values to add.
+ * @param n      The number of values to add.
+ *
+ * @retval C4CE_FULL      The stack doesn't have room for n more values.
+ *                        Nothing has been inserted.
+ * @retval C4CE_SUCCESS   Success.
+ * @retval C4CEW_NOTHING  n is zero.
+ */
+C4C_METHOD(c4c_res_t, push_n, C4C_THIS stack, const C4C_PARAM_CONTENT_TYPE* src, size_t n);
+
+/**
+ * Insert a new uninitialized value at the end of the stack and return a pointer
+ * to it so that it can be constructed in place (no copies).
+ *
+ * @param stack  The LIFO stack.
+ *
+ * @return The new element. NULL if the stack is already full.
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, emplace, C4C_THIS stack);
+
 /**
  * Remove the value at the top of the stack and return it.
  *
@@ -106,6 +138,31 @@ C4C_METHOD(c4c_res_t, push, C4C_THIS stack, C4C_PARAM_CONTENT_TYPE new_element);
  */
 C4C_METHOD(C4C_PARAM_CONTENT_TYPE, pop, C4C_THIS stack);
 
+/**
+ * Remove up to n values from the top of the stack with a single copy.
+ *
+ * @note The values are stored in push order: dst[0] is the deepest one and
+ *       dst[count - 1] the one pop() would have returned first, so push_n()
+ *       with the same array restores the stack.
+ *
+ * @param stack  The LIFO stack.
+ * @param dst    Receives the removed values (room for n values).
+ * @param n      The maximum number of values to remove.
+ *
+ * @return The number of removed values (less than n if the stack holds fewer
+ *         values).
+ */
+C4C_METHOD(size_t, pop_n, C4C_THIS stack, C4C_PARAM_CONTENT_TYPE* dst, size_t n);
+
+/**
+ * Get the value at the top of the stack without removing it.
+ *
+ * @param stack  The LIFO stack.
+ *
+ * @return The element at the top of the stack. NULL if the stack is empty.
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, top, C4C_THIS stack);
+
 /**
  * Get the stack maximum capacity.
  *
@@ -28,7 +28,7 @@
 
 #include "c4c/internal/common_headers.h"
 
-#include <string.h> /* for memset() */
+#include <string.h> /* for memcpy(), memset() */
 
 /*------------------------------------------------------------------------------
 	params
@@ -45,10 +45,12 @@
 
 C4C_METHOD(void, clear, C4C_THIS stack)
 {
-	if (stack->count != 0) {
-		stack->count = 0;
-		memset(stack->elements, 0, sizeof(C4C_PARAM_CONTENT_TYPE) * C4C_PARAM_CAPACITY);
-	}
+#ifdef C4C_FEATURE_STACK_SCRUB
+	/* Popped slots have already been scrubbed by pop(). */
+	if (stack->count != 0)
+		memset(stack->elements, 0, sizeof(C4C_PARAM_CONTENT_TYPE) * stack->count);
+#endif
+	stack->count = 0;
 }
 
 C4C_METHOD(c4c_res_t, push, C4C_THIS stack, C4C_PARAM_CONTENT_TYPE new_element)
@@ -60,14 +62,63 @@ C4C_METHOD(c4c_res_t, push, C4C_THIS stack, C4C_PARAM_CONTENT_TYPE new_element)
 	return C4CE_SUCCESS;
 }
 
+C4C_METHOD(c4c_res_t, push_n, C4C_THIS stack, const C4C_PARAM_CONTENT_TYPE* src, size_t n)
+{
+	if (n == 0)
+		return C4CEW_NOTHING;
+	if (n > C4C_PARAM_CAPACITY - stack->count)
+		return C4CE_FULL;
+	memcpy(stack->elements + stack->count, src, sizeof(C4C_PARAM_CONTENT_TYPE) * n);
+	stack->count += n;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, emplace, C4C_THIS stack)
+{
+	if (stack->count >= C4C_PARAM_CAPACITY)
+		return NULL;
+	++stack->count;
+	return stack->elements + (stack->count - 1);
+}
+
 C4C_METHOD(C4C_PARAM_CONTENT_TYPE, pop, C4C_THIS stack)
 {
+#ifdef C4C_FEATURE_STACK_SCRUB
+	C4C_PARAM_CONTENT_TYPE bottom;
+#endif
 	if (stack->count == 0)
 		return (C4C_PARAM_CONTENT_TYPE)C4C_PARAM_OPT_NO_VALUE;
 	--stack->count;
-	C4C_PARAM_CONTENT_TYPE bottom = stack->elements[stack->count];
+#ifdef C4C_FEATURE_STACK_SCRUB
+	bottom = stack->elements[stack->count];
 	stack->elements[stack->count] = (C4C_PARAM_CONTENT_TYPE)C4C_PARAM_OPT_NO_VALUE;
 	return bottom;
+#else
+	return stack->elements[stack->count];
+#endif
+}
+
+C4C_METHOD(size_t, pop_n, C4C_THIS stack, C4C_PARAM_CONTENT_TYPE* dst, size_t n)
+{
+#ifdef C4C_FEATURE_STACK_SCRUB
+	size_t i;
+#endif
+	if (n > stack->count)
+		n = stack->count;
+	if (n == 0)
+		return 0;
+	stack->count -= n;
+	memcpy(dst, stack->elements + stack->count, sizeof(C4C_PARAM_CONTENT_TYPE) * n);
+#ifdef C4C_FEATURE_STACK_SCRUB
+	for (i = stack->count; i < stack->count + n; ++i)
+		stack->elements[i] = (C4C_PARAM_CONTENT_TYPE)C4C_PARAM_OPT_NO_VALUE;
+#endif
+	return n;
+}
+
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, top, C4C_THIS stack)
+{
+	return stack->count != 0 ? stack->elements + (stack->count - 1) : NULL;
 }
 
 /*------------------------------------------------------------------------------
@@ -0,0 +1,162 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/**
+ * Container:
+ * 		Lock-free LIFO stack.
+ *
+ * Brief description:
+ * 		Treiber stack of intrusive nodes that any number of threads can push
+ * 		to and pop from concurrently. Declares two types: C4C_PARAM_STRUCT_NAME,
+ * 		the node (C4C_PARAM_CONTENT plus a next pointer), and
+ * 		C4C_PARAM_STRUCT_NAME_head, the stack itself. The top of the stack is a
+ * 		tagged pointer whose counter is bumped by every pop so that a
+ * 		compare-and-swap can't succeed on a recycled node (ABA problem). See
+ * 		internal/atomic.h for the counter width on each platform.
+ *
+ * Supports allocators: NO
+ * Container type:      INTRUSIVE
+ *
+ * Features:
+ * - Lock-free push/pop from any number of threads.
+ * - pop_all() to grab the whole stack with a single compare-and-swap.
+ * - No heap allocations/deallocations.
+ * - No max capacity.
+ *
+ * @warning A popping thread may read the next pointer of a node that another
+ *          thread has just popped: nodes may be reused (that's the point) but
+ *          their memory must not be returned to the OS while the stack is in
+ *          use.
+ */
+
+#include "c4c/internal/common_headers.h"
+#include "c4c/internal/atomic.h"
+
+#include <stddef.h> /* for size_t */
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+/*
+Parameters:
+
+#define C4C_PARAM_STRUCT_NAME 
+#define C4C_PARAM_PREFIX 
+#define C4C_PARAM_CONTENT 
+*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/content.h"
+
+#define __C4C_LOCKFREE_LIFO_HEAD_(name) _C4C_CONCAT(name, _head)
+#define __C4C_LOCKFREE_LIFO_HEAD __C4C_LOCKFREE_LIFO_HEAD_(C4C_PARAM_STRUCT_NAME)
+#define __C4C_LOCKFREE_LIFO_HEAD_THIS C4C_STRUCT_DECLARE(__C4C_LOCKFREE_LIFO_HEAD)*
+
+/*------------------------------------------------------------------------------
+   stack structs definition
+------------------------------------------------------------------------------*/
+
+C4C_STRUCT_BEGIN(C4C_PARAM_STRUCT_NAME)
+	C4C_PARAM_CONTENT
+	struct C4C_PARAM_STRUCT_NAME* next;
+C4C_STRUCT_END(C4C_PARAM_STRUCT_NAME)
+
+C4C_STRUCT_BEGIN(__C4C_LOCKFREE_LIFO_HEAD)
+	volatile c4c_tagged_ptr_t top;
+C4C_STRUCT_END(__C4C_LOCKFREE_LIFO_HEAD)
+
+/*------------------------------------------------------------------------------
+    stack functions
+------------------------------------------------------------------------------*/
+
+/**
+ * Prepare the stack for usage.
+ *
+ * @warning Not thread safe.
+ *
+ * @param head  The stack.
+ */
+C4C_METHOD(void, init, __C4C_LOCKFREE_LIFO_HEAD_THIS head);
+
+/**
+ * Insert a node at the top of the stack.
+ *
+ * @note Thread safe.
+ *
+ * @param head  The stack.
+ * @param node  The node to add. Must not be in the stack already.
+ */
+C4C_METHOD(void, push, __C4C_LOCKFREE_LIFO_HEAD_THIS head, C4C_THIS node);
+
+/**
+ * Remove the node at the top of the stack and return it.
+ *
+ * @note Thread safe.
+ *
+ * @param head  The stack.
+ *
+ * @return The removed node. NULL if the stack is empty.
+ */
+C4C_METHOD(C4C_THIS, pop, __C4C_LOCKFREE_LIFO_HEAD_THIS head);
+
+/**
+ * Remove every node from the stack at once.
+ *
+ * @note Thread safe.
+ *
+ * @param head  The stack.
+ *
+ * @return The former top of the stack, the other nodes follow through their
+ *         next pointers (NULL terminated). NULL if the stack is empty.
+ */
+C4C_METHOD(C4C_THIS, pop_all, __C4C_LOCKFREE_LIFO_HEAD_THIS head);
+
+/**
+ * Test whether the stack is empty.
+ *
+ * @note Thread safe, but the result may be outdated as soon as it is returned.
+ *
+ * @param head  The stack.
+ *
+ * @return 1 if the stack is empty. 0 otherwise.
+ */
+C4C_METHOD(int, is_empty, __C4C_LOCKFREE_LIFO_HEAD_THIS head);
+
+/*------------------------------------------------------------------------------
+    undef header params
+------------------------------------------------------------------------------*/
+
+#undef __C4C_LOCKFREE_LIFO_HEAD_
+#undef __C4C_LOCKFREE_LIFO_HEAD
+#undef __C4C_LOCKFREE_LIFO_HEAD_THIS
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/content_undef.h"
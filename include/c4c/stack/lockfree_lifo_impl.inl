@@ -0,0 +1,109 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include "c4c/internal/common_headers.h"
+#include "c4c/internal/atomic.h"
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/content.h"
+
+#define __C4C_LOCKFREE_LIFO_HEAD_(name) _C4C_CONCAT(name, _head)
+#define __C4C_LOCKFREE_LIFO_HEAD __C4C_LOCKFREE_LIFO_HEAD_(C4C_PARAM_STRUCT_NAME)
+#define __C4C_LOCKFREE_LIFO_HEAD_THIS C4C_STRUCT_DECLARE(__C4C_LOCKFREE_LIFO_HEAD)*
+
+/*------------------------------------------------------------------------------
+    stack functions implementation
+------------------------------------------------------------------------------*/
+
+C4C_METHOD(void, init, __C4C_LOCKFREE_LIFO_HEAD_THIS head)
+{
+	head->top = __C4C_TAGGED_MAKE(NULL, 0);
+}
+
+C4C_METHOD(void, push, __C4C_LOCKFREE_LIFO_HEAD_THIS head, C4C_THIS node)
+{
+	c4c_tagged_ptr_t top, new_top;
+	do {
+		top = __C4C_ATOMIC_LOAD_TAGGED(&head->top);
+		__C4C_ATOMIC_STORE_RELAXED(&node->next, (C4C_THIS)__C4C_TAGGED_PTR(top));
+		/* Only pops need to bump the counter: a node can't be pushed twice. */
+		new_top = __C4C_TAGGED_MAKE(node, __C4C_TAGGED_TAG(top));
+	} while (!__C4C_ATOMIC_CAS_TAGGED(&head->top, top, new_top));
+}
+
+C4C_METHOD(C4C_THIS, pop, __C4C_LOCKFREE_LIFO_HEAD_THIS head)
+{
+	c4c_tagged_ptr_t top, new_top;
+	C4C_THIS node;
+	do {
+		top = __C4C_ATOMIC_LOAD_TAGGED(&head->top);
+		node = (C4C_THIS)__C4C_TAGGED_PTR(top);
+		if (!node)
+			return NULL;
+		/* node may be popped (and reused) by another thread right now: next
+		 * can be garbage but the CAS below will fail then. */
+		new_top = __C4C_TAGGED_MAKE(__C4C_ATOMIC_LOAD_RELAXED(&node->next), __C4C_TAGGED_TAG(top) + 1);
+	} while (!__C4C_ATOMIC_CAS_TAGGED(&head->top, top, new_top));
+	return node;
+}
+
+C4C_METHOD(C4C_THIS, pop_all, __C4C_LOCKFREE_LIFO_HEAD_THIS head)
+{
+	c4c_tagged_ptr_t top, new_top;
+	C4C_THIS node;
+	do {
+		top = __C4C_ATOMIC_LOAD_TAGGED(&head->top);
+		node = (C4C_THIS)__C4C_TAGGED_PTR(top);
+		if (!node)
+			return NULL;
+		new_top = __C4C_TAGGED_MAKE(NULL, __C4C_TAGGED_TAG(top) + 1);
+	} while (!__C4C_ATOMIC_CAS_TAGGED(&head->top, top, new_top));
+	return node;
+}
+
+C4C_METHOD(int, is_empty, __C4C_LOCKFREE_LIFO_HEAD_THIS head)
+{
+	return __C4C_TAGGED_PTR(__C4C_ATOMIC_LOAD_TAGGED(&head->top)) == NULL;
+}
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#undef __C4C_LOCKFREE_LIFO_HEAD_
+#undef __C4C_LOCKFREE_LIFO_HEAD
+#undef __C4C_LOCKFREE_LIFO_HEAD_THIS
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/content_undef.h"
@@ -0,0 +1,310 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/**
+ * Container:
+ * 		Bit vector.
+ *
+ * Brief description:
+ * 		Dynamic array of bits packed into 64 bit words. Takes 8 to 32 times
+ * 		less memory than a vector of chars/ints used as booleans and works on
+ * 		64 bits at a time for bulk operations.
+ *
+ * Supports allocators: YES
+ * Container type:      DYNAMIC
+ *
+ * Features:
+ * - Random access (get/set/flip) by index.
+ * - push/pop bits at the back, append runs of equal bits a word at a time.
+ * - Word-wise AND/OR/XOR between bit vectors of the same size.
+ * - Population count using the hardware instruction when available.
+ * - Optional rank/select directory (C4C_PARAM_OPT_RANK_SELECT).
+ */
+
+#include "c4c/internal/allocators_decl.h"
+#include "c4c/internal/common_headers.h"
+
+#include <stdint.h> /* for uint64_t */
+
+#ifdef C4C_ALLOC_STATIC
+#  error The bit vector is dynamic only: C4C_ALLOC_STATIC is not supported.
+#endif
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+/*
+Parameters:
+
+#define C4C_PARAM_STRUCT_NAME 
+#define C4C_PARAM_PREFIX 
+#define C4C_PARAM_OPT_GROWTH
+#define C4C_PARAM_OPT_RANK_SELECT
+*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/optrankselect.h"
+
+/* Growth is computed in words: grow geometrically by default. */
+#ifndef C4C_PARAM_OPT_GROWTH
+#  define C4C_PARAM_OPT_GROWTH C4C_GROWTH_2X
+#endif
+#include "c4c/internal/params/optgrowth.h"
+
+/*------------------------------------------------------------------------------
+	bit vector struct definition
+------------------------------------------------------------------------------*/
+
+/*
+ * The bits past size are always zero so that whole words can be processed
+ * without masking the last one.
+ */
+C4C_STRUCT_BEGIN(C4C_PARAM_STRUCT_NAME)
+	size_t size;
+	size_t capacity;
+	uint64_t* words;
+#if C4C_PARAM_OPT_RANK_SELECT
+	size_t* ranks;
+	size_t ranks_count;
+	int ranks_valid;
+#endif
+C4C_STRUCT_END(C4C_PARAM_STRUCT_NAME)
+
+/*------------------------------------------------------------------------------
+	bit vector functions
+------------------------------------------------------------------------------*/
+
+/**
+ * Initialize a new bit vector.
+ *
+ * @param vec       The bit vector.
+ * @param capacity  The initial capacity in bits (rounded up to whole words).
+ *                  Can be zero.
+ *
+ * @retval C4CE_MALLOC_FAIL  C4C_ALLOC() failed.
+ * @retval C4CE_SUCCESS      Success.
+ */
+C4C_METHOD(c4c_res_t, init, C4C_THIS vec, size_t capacity);
+
+/**
+ * Free the bit vector's memory and prepare for new usage (must re-initialize
+ * first).
+ *
+ * @param vec  The bit vector.
+ */
+C4C_METHOD(void, free, C4C_THIS vec);
+
+/**
+ * Make sure the bit vector can hold at least the specified number of bits
+ * without further reallocations. Never shrinks the bit vector.
+ *
+ * @param vec       The bit vector.
+ * @param capacity  The minimum capacity in bits.
+ *
+ * @retval C4CE_REALLOC_FAIL  Memory reallocation failed. The bit vector is left
+ *                            untouched.
+ * @retval C4CE_SUCCESS       Success.
+ * @retval C4CEW_NOTHING      The bit vector can already hold capacity bits.
+ */
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS vec, size_t capacity);
+
+/**
+ * Remove every bit. The capacity is left untouched.
+ *
+ * @param vec  The bit vector.
+ */
+C4C_METHOD(void, clear, C4C_THIS vec);
+
+/**
+ * Insert a new bit at the end of the bit vector.
+ *
+ * @note If the bit vector is full it will grow following C4C_PARAM_OPT_GROWTH.
+ *
+ * @param vec  The bit vector.
+ * @param bit  The bit to add (any non-zero value is a 1).
+ *
+ * @retval reserve()'s   error codes.
+ * @retval C4CE_SUCCESS  Success.
+ */
+C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec, int bit);
+
+/**
+ * Insert n copies of the same bit at the end of the bit vector growing it (at
+ * most) once. Whole words are filled at a time.
+ *
+ * @param vec  The bit vector.
+ * @param bit  The bit to add (any non-zero value is a 1).
+ * @param n    The number of bits to add.
+ *
+ * @retval reserve()'s    error codes.
+ * @retval C4CE_SUCCESS   Success.
+ * @retval C4CEW_NOTHING  n is zero.
+ */
+C4C_METHOD(c4c_res_t, append_n, C4C_THIS vec, int bit, size_t n);
+
+/**
+ * Remove the last bit of the bit vector.
+ *
+ * @param vec  The bit vector.
+ *
+ * @retval C4CE_EMPTY    The bit vector is already empty.
+ * @retval C4CE_SUCCESS  Success.
+ */
+C4C_METHOD(c4c_res_t, pop_back, C4C_THIS vec);
+
+/**
+ * Get the bit at the specified index position.
+ *
+ * @warning No bounds checking: index must be < size.
+ *
+ * @param vec    The bit vector.
+ * @param index  The position of the bit.
+ *
+ * @return 1 if the bit is set. 0 otherwise.
+ */
+C4C_METHOD(int, get, const C4C_THIS vec, size_t index);
+
+/**
+ * Set the bit at the specified index position.
+ *
+ * @warning No bounds checking: index must be < size.
+ *
+ * @param vec    The bit vector.
+ * @param index  The position of the bit.
+ * @param bit    The new value (any non-zero value is a 1).
+ */
+C4C_METHOD(void, set, C4C_THIS vec, size_t index, int bit);
+
+/**
+ * Invert the bit at the specified index position.
+ *
+ * @warning No bounds checking: index must be < size.
+ *
+ * @param vec    The bit vector.
+ * @param index  The position of the bit.
+ */
+C4C_METHOD(void, flip, C4C_THIS vec, size_t index);
+
+/**
+ * dst = dst AND src, a word at a time.
+ *
+ * @param dst  The destination bit vector.
+ * @param src  The source bit vector.
+ *
+ * @retval C4CE_INVALID_ARG  The bit vectors have different sizes.
+ * @retval C4CE_SUCCESS      Success.
+ */
+C4C_METHOD(c4c_res_t, bit_and, C4C_THIS dst, const C4C_THIS src);
+
+/**
+ * dst = dst OR src, a word at a time.
+ *
+ * @param dst  The destination bit vector.
+ * @param src  The source bit vector.
+ *
+ * @retval C4CE_INVALID_ARG  The bit vectors have different sizes.
+ * @retval C4CE_SUCCESS      Success.
+ */
+C4C_METHOD(c4c_res_t, bit_or, C4C_THIS dst, const C4C_THIS src);
+
+/**
+ * dst = dst XOR src, a word at a time.
+ *
+ * @param dst  The destination bit vector.
+ * @param src  The source bit vector.
+ *
+ * @retval C4CE_INVALID_ARG  The bit vectors have different sizes.
+ * @retval C4CE_SUCCESS      Success.
+ */
+C4C_METHOD(c4c_res_t, bit_xor, C4C_THIS dst, const C4C_THIS src);
+
+/**
+ * Count the set bits.
+ *
+ * @param vec  The bit vector.
+ *
+ * @return The number of bits set to 1.
+ */
+C4C_METHOD(size_t, count, const C4C_THIS vec);
+
+#if C4C_PARAM_OPT_RANK_SELECT
+/**
+ * (Re)build the rank directory. Must be called after modifying the bit vector
+ * for rank() and select() to use it again (they fall back to a linear scan
+ * otherwise).
+ *
+ * @note Only available if C4C_PARAM_OPT_RANK_SELECT is 1.
+ *
+ * @param vec  The bit vector.
+ *
+ * @retval C4CE_REALLOC_FAIL  Memory reallocation failed. The old directory (if
+ *                            any) is left untouched but not valid.
+ * @retval C4CE_SUCCESS       Success.
+ */
+C4C_METHOD(c4c_res_t, build_rank, C4C_THIS vec);
+
+/**
+ * Count the set bits before the specified index position.
+ *
+ * @note Only available if C4C_PARAM_OPT_RANK_SELECT is 1.
+ *
+ * @warning No bounds checking: index must be <= size.
+ *
+ * @param vec    The bit vector.
+ * @param index  The end (excluded) of the range to count.
+ *
+ * @return The number of bits set to 1 in [0, index).
+ */
+C4C_METHOD(size_t, rank, const C4C_THIS vec, size_t index);
+
+/**
+ * Find the position of the k-th set bit.
+ *
+ * @note Only available if C4C_PARAM_OPT_RANK_SELECT is 1.
+ *
+ * @param vec  The bit vector.
+ * @param k    Which set bit to find (0 is the first one).
+ *
+ * @return The index of the k-th bit set to 1. size if there are not enough set
+ *         bits.
+ */
+C4C_METHOD(size_t, select, const C4C_THIS vec, size_t k);
+#endif
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/optrankselect_undef.h"
+#include "c4c/internal/params/optgrowth_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
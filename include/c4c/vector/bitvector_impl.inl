@@ -0,0 +1,335 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include "c4c/internal/allocators_impl.h"
+#include "c4c/internal/common_headers.h"
+#include "c4c/internal/bitops.h"
+
+#include <stdint.h> /* for uint64_t */
+#include <string.h> /* for memset() */
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/optrankselect.h"
+
+#ifndef C4C_PARAM_OPT_GROWTH
+#  define C4C_PARAM_OPT_GROWTH C4C_GROWTH_2X
+#endif
+#include "c4c/internal/params/optgrowth.h"
+
+/*------------------------------------------------------------------------------
+    bit vector static functions
+------------------------------------------------------------------------------*/
+
+/* Number of words needed to store bits_ bits. */
+#define _bitvector_words_(bits_) (((bits_) + 63) >> 6)
+
+/* Words per rank directory block. */
+#define _bitvector_block_words_ 8
+
+#if C4C_PARAM_OPT_RANK_SELECT
+#  define _bitvector_invalidate_(vec_) ((vec_)->ranks_valid = 0)
+#else
+#  define _bitvector_invalidate_(vec_) ((void)0)
+#endif
+
+C4C_METHOD_INLINE(c4c_res_t, grow_, C4C_THIS vec, size_t required)
+{
+	size_t words;
+	if (required <= vec->capacity)
+		return C4CE_SUCCESS;
+	words = (size_t)C4C_PARAM_OPT_GROWTH(vec->capacity >> 6);
+	if (words < _bitvector_words_(required))
+		words = _bitvector_words_(required);
+	return C4C_METHOD_CALL(reserve, vec, words << 6);
+}
+
+/*------------------------------------------------------------------------------
+    bit vector functions implementation
+------------------------------------------------------------------------------*/
+
+C4C_METHOD(c4c_res_t, init, C4C_THIS vec, size_t capacity)
+{
+	vec->size = 0;
+	vec->capacity = 0;
+	vec->words = NULL;
+#if C4C_PARAM_OPT_RANK_SELECT
+	vec->ranks = NULL;
+	vec->ranks_count = 0;
+	vec->ranks_valid = 0;
+#endif
+	if (capacity == 0)
+		return C4CE_SUCCESS;
+	if (!c4c_succeeded(C4C_METHOD_CALL(reserve, vec, capacity)))
+		return C4CE_MALLOC_FAIL;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(void, free, C4C_THIS vec)
+{
+	C4C_FREE(vec->words);
+	vec->size = 0;
+	vec->capacity = 0;
+	vec->words = NULL;
+#if C4C_PARAM_OPT_RANK_SELECT
+	C4C_FREE(vec->ranks);
+	vec->ranks = NULL;
+	vec->ranks_count = 0;
+	vec->ranks_valid = 0;
+#endif
+}
+
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS vec, size_t capacity)
+{
+	uint64_t* words;
+	size_t old_count = vec->capacity >> 6;
+	size_t count = _bitvector_words_(capacity);
+	if (count <= old_count)
+		return C4CEW_NOTHING;
+	words = C4C_REALLOC(vec->words, sizeof(uint64_t) * count);
+	if (!words)
+		return C4CE_REALLOC_FAIL;
+	/* keep the bits past size zeroed */
+	memset(words + old_count, 0, sizeof(uint64_t) * (count - old_count));
+	vec->words = words;
+	vec->capacity = count << 6;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(void, clear, C4C_THIS vec)
+{
+	if (vec->size != 0)
+		memset(vec->words, 0, sizeof(uint64_t) * _bitvector_words_(vec->size));
+	vec->size = 0;
+	_bitvector_invalidate_(vec);
+}
+
+C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec, int bit)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + 1)))
+		return err;
+	vec->words[vec->size >> 6] |= (uint64_t)(bit != 0) << (vec->size & 63);
+	++vec->size;
+	_bitvector_invalidate_(vec);
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, append_n, C4C_THIS vec, int bit, size_t n)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	size_t first, last;
+	if (n == 0)
+		return C4CEW_NOTHING;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + n)))
+		return err;
+	if (bit) {
+		first = vec->size >> 6;
+		last = (vec->size + n - 1) >> 6;
+		/* the bits past size are zero: OR the ones in */
+		if (first == last) {
+			vec->words[first] |= (~(uint64_t)0 >> (64 - n)) << (vec->size & 63);
+		} else {
+			vec->words[first] |= ~(uint64_t)0 << (vec->size & 63);
+			if (last - first > 1)
+				memset(vec->words + first + 1, 0xFF, sizeof(uint64_t) * (last - first - 1));
+			vec->words[last] = ~(uint64_t)0 >> (63 - ((vec->size + n - 1) & 63));
+		}
+	}
+	vec->size += n;
+	_bitvector_invalidate_(vec);
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, pop_back, C4C_THIS vec)
+{
+	if (vec->size == 0)
+		return C4CE_EMPTY;
+	--vec->size;
+	vec->words[vec->size >> 6] &= ~((uint64_t)1 << (vec->size & 63));
+	_bitvector_invalidate_(vec);
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(int, get, const C4C_THIS vec, size_t index)
+{
+	return (int)((vec->words[index >> 6] >> (index & 63)) & 1);
+}
+
+C4C_METHOD(void, set, C4C_THIS vec, size_t index, int bit)
+{
+	uint64_t mask = (uint64_t)1 << (index & 63);
+	uint64_t* word = vec->words + (index >> 6);
+	*word = (*word & ~mask) | (((uint64_t)0 - (uint64_t)(bit != 0)) & mask);
+	_bitvector_invalidate_(vec);
+}
+
+C4C_METHOD(void, flip, C4C_THIS vec, size_t index)
+{
+	vec->words[index >> 6] ^= (uint64_t)1 << (index & 63);
+	_bitvector_invalidate_(vec);
+}
+
+C4C_METHOD(c4c_res_t, bit_and, C4C_THIS dst, const C4C_THIS src)
+{
+	size_t i, count;
+	if (dst->size != src->size)
+		return C4CE_INVALID_ARG;
+	count = _bitvector_words_(dst->size);
+	for (i = 0; i < count; ++i)
+		dst->words[i] &= src->words[i];
+	_bitvector_invalidate_(dst);
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, bit_or, C4C_THIS dst, const C4C_THIS src)
+{
+	size_t i, count;
+	if (dst->size != src->size)
+		return C4CE_INVALID_ARG;
+	count = _bitvector_words_(dst->size);
+	for (i = 0; i < count; ++i)
+		dst->words[i] |= src->words[i];
+	_bitvector_invalidate_(dst);
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, bit_xor, C4C_THIS dst, const C4C_THIS src)
+{
+	size_t i, count;
+	if (dst->size != src->size)
+		return C4CE_INVALID_ARG;
+	count = _bitvector_words_(dst->size);
+	for (i = 0; i < count; ++i)
+		dst->words[i] ^= src->words[i];
+	_bitvector_invalidate_(dst);
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(size_t, count, const C4C_THIS vec)
+{
+	size_t i, count = _bitvector_words_(vec->size), ones = 0;
+	for (i = 0; i < count; ++i)
+		ones += __C4C_POPCOUNT64(vec->words[i]);
+	return ones;
+}
+
+#if C4C_PARAM_OPT_RANK_SELECT
+C4C_METHOD(c4c_res_t, build_rank, C4C_THIS vec)
+{
+	size_t* ranks;
+	size_t i, count = _bitvector_words_(vec->size), ones = 0;
+	/* one entry per block plus the total */
+	size_t ranks_count = (count + _bitvector_block_words_ - 1) / _bitvector_block_words_ + 1;
+	vec->ranks_valid = 0;
+	if (ranks_count > vec->ranks_count) {
+		ranks = C4C_REALLOC(vec->ranks, sizeof(size_t) * ranks_count);
+		if (!ranks)
+			return C4CE_REALLOC_FAIL;
+		vec->ranks = ranks;
+	}
+	vec->ranks_count = ranks_count;
+	for (i = 0; i < count; ++i) {
+		if (i % _bitvector_block_words_ == 0)
+			vec->ranks[i / _bitvector_block_words_] = ones;
+		ones += __C4C_POPCOUNT64(vec->words[i]);
+	}
+	vec->ranks[ranks_count - 1] = ones;
+	vec->ranks_valid = 1;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(size_t, rank, const C4C_THIS vec, size_t index)
+{
+	size_t i = 0, last = index >> 6, ones = 0;
+	if (vec->ranks_valid) {
+		i = last / _bitvector_block_words_ * _bitvector_block_words_;
+		ones = vec->ranks[last / _bitvector_block_words_];
+	}
+	for (; i < last; ++i)
+		ones += __C4C_POPCOUNT64(vec->words[i]);
+	if (index & 63)
+		ones += __C4C_POPCOUNT64(vec->words[last] & (~(uint64_t)0 >> (64 - (index & 63))));
+	return ones;
+}
+
+C4C_METHOD(size_t, select, const C4C_THIS vec, size_t k)
+{
+	size_t lo, hi, mid, i = 0, count = _bitvector_words_(vec->size);
+	unsigned ones;
+	uint64_t word;
+	if (vec->ranks_valid) {
+		if (k >= vec->ranks[vec->ranks_count - 1])
+			return vec->size;
+		/* last block starting with at most k ones before it */
+		lo = 0;
+		hi = vec->ranks_count - 1;
+		while (hi - lo > 1) {
+			mid = lo + (hi - lo) / 2;
+			if (vec->ranks[mid] <= k)
+				lo = mid;
+			else
+				hi = mid;
+		}
+		i = lo * _bitvector_block_words_;
+		k -= vec->ranks[lo];
+	}
+	for (; i < count; ++i) {
+		word = vec->words[i];
+		ones = __C4C_POPCOUNT64(word);
+		if (k < ones) {
+			/* drop the k lowest set bits */
+			while (k--)
+				word &= word - 1;
+			return (i << 6) + __C4C_CTZ64(word);
+		}
+		k -= ones;
+	}
+	return vec->size;
+}
+#endif
+
+/* undef static functions macros */
+#undef _bitvector_words_
+#undef _bitvector_block_words_
+#undef _bitvector_invalidate_
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/optrankselect_undef.h"
+#include "c4c/internal/params/optgrowth_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
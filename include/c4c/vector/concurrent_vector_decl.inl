@@ -0,0 +1,204 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/**
+ * Container:
+ * 		Concurrent append vector.
+ *
+ * Brief description:
+ * 		Vector that many threads can append to at the same time without locks.
+ * 		A slot is reserved with an atomic fetch-add on size, then the element
+ * 		is written and published through a per-slot ready flag. Storage is a
+ * 		fixed table of buckets of geometrically increasing size (the first
+ * 		one holds 2^C4C_PARAM_OPT_CHUNK_SHIFT elements, every other one twice
+ * 		the previous): buckets are installed with a single compare-and-swap
+ * 		and never moved, so appends never race with a reallocation.
+ *
+ * Supports allocators: YES
+ * Container type:      DYNAMIC
+ *
+ * Features:
+ * - Lock-free push_back/emplace_back from any number of threads.
+ * - Stable element addresses.
+ * - Readers can scan while writers append: at() only returns published
+ *   elements.
+ * - O(1) random access by index (one bit scan, two loads).
+ * - No removal: free() the whole vector once every thread is done with it.
+ */
+
+#include "c4c/internal/allocators_decl.h"
+#include "c4c/internal/common_headers.h"
+
+#ifdef C4C_ALLOC_STATIC
+#  error The concurrent vector allocates its buckets on demand: C4C_ALLOC_STATIC is not supported.
+#endif
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+/*
+Parameters:
+
+#define C4C_PARAM_STRUCT_NAME 
+#define C4C_PARAM_PREFIX 
+#define C4C_PARAM_CONTENT_TYPE 
+#define C4C_PARAM_OPT_CHUNK_SHIFT
+*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/contenttype.h"
+#include "c4c/internal/params/optchunkshift.h"
+
+/*------------------------------------------------------------------------------
+	concurrent vector struct definition
+------------------------------------------------------------------------------*/
+
+/*
+ * Every bucket is followed (same allocation) by one ready flag per element.
+ * The bucket table is big enough for SIZE_MAX elements and never grows.
+ */
+C4C_STRUCT_BEGIN(C4C_PARAM_STRUCT_NAME)
+	volatile size_t size;
+	C4C_PARAM_CONTENT_TYPE* volatile buckets[sizeof(size_t) * 8 - C4C_PARAM_OPT_CHUNK_SHIFT];
+C4C_STRUCT_END(C4C_PARAM_STRUCT_NAME)
+
+/*------------------------------------------------------------------------------
+	concurrent vector functions
+------------------------------------------------------------------------------*/
+
+/**
+ * Initialize a new concurrent vector. No allocation is performed.
+ *
+ * @warning Not thread safe.
+ *
+ * @param vec  The concurrent vector.
+ */
+C4C_METHOD(void, init, C4C_THIS vec);
+
+/**
+ * Free the concurrent vector's memory and prepare for new usage (must
+ * re-initialize first).
+ *
+ * @warning Not thread safe: every other thread must be done with the vector.
+ *
+ * @param vec  The concurrent vector.
+ */
+C4C_METHOD(void, free, C4C_THIS vec);
+
+/**
+ * Allocate the buckets needed to store at least the specified number of
+ * elements so that appends don't have to.
+ *
+ * @note Thread safe.
+ *
+ * @param vec       The concurrent vector.
+ * @param capacity  The minimum capacity.
+ *
+ * @retval C4CE_MALLOC_FAIL  C4C_ALLOC() failed. The buckets allocated so far
+ *                           are kept.
+ * @retval C4CE_SUCCESS      Success.
+ */
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS vec, size_t capacity);
+
+/**
+ * Reserve a new slot at the end of the vector and return a pointer to it so
+ * that it can be constructed in place. The element is not visible to at()
+ * until publish() is called.
+ *
+ * @note Thread safe.
+ *
+ * @warning If the bucket allocation fails the reserved slot is lost: it counts
+ *          in size but will never be published.
+ *
+ * @param vec    The concurrent vector.
+ * @param index  Receives the index of the new slot (can be NULL).
+ *
+ * @return The new slot. NULL if C4C_ALLOC() failed.
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, emplace_back, C4C_THIS vec, size_t* index);
+
+/**
+ * Make an element reserved with emplace_back() visible to at(). Every write
+ * to the element made before this call is visible to the threads seeing it.
+ *
+ * @note Thread safe.
+ *
+ * @param vec    The concurrent vector.
+ * @param index  The index returned by emplace_back().
+ */
+C4C_METHOD(void, publish, C4C_THIS vec, size_t index);
+
+/**
+ * Insert a new element at the end of the vector and publish it.
+ *
+ * @note Thread safe.
+ *
+ * @param vec      The concurrent vector.
+ * @param element  The element to add.
+ *
+ * @retval C4CE_MALLOC_FAIL  C4C_ALLOC() failed (see emplace_back()).
+ * @retval C4CE_SUCCESS      Success.
+ */
+C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element);
+
+/**
+ * Get the number of reserved slots (published or not).
+ *
+ * @note Thread safe.
+ *
+ * @param vec  The concurrent vector.
+ *
+ * @return The number of reserved slots.
+ */
+C4C_METHOD(size_t, size, const C4C_THIS vec);
+
+/**
+ * Get a published element.
+ *
+ * @note Thread safe.
+ *
+ * @param vec    The concurrent vector.
+ * @param index  The position of the element.
+ *
+ * @return The element. NULL if index is out of bounds or the element hasn't
+ *         been published yet.
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, at, const C4C_THIS vec, size_t index);
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/contenttype_undef.h"
+#include "c4c/internal/params/optchunkshift_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
@@ -0,0 +1,193 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include "c4c/internal/allocators_impl.h"
+#include "c4c/internal/common_headers.h"
+#include "c4c/internal/atomic.h"
+#include "c4c/internal/bitops.h"
+
+#include <stdint.h> /* for uint64_t */
+#include <string.h> /* for memset() */
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/contenttype.h"
+#include "c4c/internal/params/optchunkshift.h"
+
+/*------------------------------------------------------------------------------
+    concurrent vector static functions
+------------------------------------------------------------------------------*/
+
+#define _concurrent_vector_first_ ((size_t)1 << C4C_PARAM_OPT_CHUNK_SHIFT)
+
+#define _concurrent_vector_buckets_ (sizeof(size_t) * 8 - C4C_PARAM_OPT_CHUNK_SHIFT)
+
+/* Bucket b holds first << b elements starting at index (first << b) - first. */
+#define _concurrent_vector_bucket_size_(bucket_) \
+	(_concurrent_vector_first_ << (bucket_))
+
+#define _concurrent_vector_bucket_of_(index_) \
+	((size_t)(63 - __C4C_CLZ64((uint64_t)(index_) + _concurrent_vector_first_)) - C4C_PARAM_OPT_CHUNK_SHIFT)
+
+#define _concurrent_vector_offset_(index_, bucket_) \
+	((index_) + _concurrent_vector_first_ - _concurrent_vector_bucket_size_(bucket_))
+
+#define _concurrent_vector_ready_(data_, bucket_) \
+	((volatile unsigned char*)((data_) + _concurrent_vector_bucket_size_(bucket_)))
+
+/*
+ * Get a bucket, allocating and installing it if needed. Threads racing to
+ * install the same bucket all allocate one, the losers free theirs.
+ */
+C4C_METHOD_INLINE(C4C_PARAM_CONTENT_TYPE*, bucket_, C4C_THIS vec, size_t bucket)
+{
+	C4C_PARAM_CONTENT_TYPE* data = __C4C_ATOMIC_LOAD_ACQUIRE(&vec->buckets[bucket]);
+	size_t n;
+	if (data)
+		return data;
+	n = _concurrent_vector_bucket_size_(bucket);
+	data = C4C_ALLOC(sizeof(C4C_PARAM_CONTENT_TYPE) * n + n);
+	if (!data)
+		return NULL;
+	memset(data + n, 0, n);
+	if (!__C4C_ATOMIC_CAS_PTR(&vec->buckets[bucket], (C4C_PARAM_CONTENT_TYPE*)NULL, data)) {
+		C4C_FREE(data);
+		data = __C4C_ATOMIC_LOAD_ACQUIRE(&vec->buckets[bucket]);
+	}
+	return data;
+}
+
+/*------------------------------------------------------------------------------
+    concurrent vector functions implementation
+------------------------------------------------------------------------------*/
+
+C4C_METHOD(void, init, C4C_THIS vec)
+{
+	size_t i;
+	vec->size = 0;
+	for (i = 0; i < _concurrent_vector_buckets_; ++i)
+		vec->buckets[i] = NULL;
+}
+
+C4C_METHOD(void, free, C4C_THIS vec)
+{
+	size_t i;
+	for (i = 0; i < _concurrent_vector_buckets_; ++i) {
+		C4C_FREE(vec->buckets[i]);
+		vec->buckets[i] = NULL;
+	}
+	vec->size = 0;
+}
+
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS vec, size_t capacity)
+{
+	size_t bucket, last;
+	if (capacity == 0)
+		return C4CE_SUCCESS;
+	last = _concurrent_vector_bucket_of_(capacity - 1);
+	for (bucket = 0; bucket <= last; ++bucket) {
+		if (!C4C_METHOD_INLINE_CALL(bucket_, vec, bucket))
+			return C4CE_MALLOC_FAIL;
+	}
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, emplace_back, C4C_THIS vec, size_t* index)
+{
+	size_t i = __C4C_ATOMIC_FETCH_ADD_SIZE(&vec->size, 1);
+	size_t bucket = _concurrent_vector_bucket_of_(i);
+	C4C_PARAM_CONTENT_TYPE* data = C4C_METHOD_INLINE_CALL(bucket_, vec, bucket);
+	if (!data)
+		return NULL;
+	if (index)
+		*index = i;
+	return data + _concurrent_vector_offset_(i, bucket);
+}
+
+C4C_METHOD(void, publish, C4C_THIS vec, size_t index)
+{
+	size_t bucket = _concurrent_vector_bucket_of_(index);
+	C4C_PARAM_CONTENT_TYPE* data = __C4C_ATOMIC_LOAD_ACQUIRE(&vec->buckets[bucket]);
+	__C4C_ATOMIC_STORE_RELEASE(_concurrent_vector_ready_(data, bucket) +
+		_concurrent_vector_offset_(index, bucket), (unsigned char)1);
+}
+
+C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element)
+{
+	size_t index;
+	C4C_PARAM_CONTENT_TYPE* slot = C4C_METHOD_CALL(emplace_back, vec, &index);
+	if (!slot)
+		return C4CE_MALLOC_FAIL;
+	*slot = element;
+	C4C_METHOD_CALL(publish, vec, index);
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(size_t, size, const C4C_THIS vec)
+{
+	return __C4C_ATOMIC_LOAD_ACQUIRE(&vec->size);
+}
+
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, at, const C4C_THIS vec, size_t index)
+{
+	size_t bucket, offset;
+	C4C_PARAM_CONTENT_TYPE* data;
+	if (index >= __C4C_ATOMIC_LOAD_ACQUIRE(&vec->size))
+		return NULL;
+	bucket = _concurrent_vector_bucket_of_(index);
+	data = __C4C_ATOMIC_LOAD_ACQUIRE(&vec->buckets[bucket]);
+	if (!data)
+		return NULL;
+	offset = _concurrent_vector_offset_(index, bucket);
+	if (!__C4C_ATOMIC_LOAD_ACQUIRE(_concurrent_vector_ready_(data, bucket) + offset))
+		return NULL;
+	return data + offset;
+}
+
+/* undef static functions macros */
+#undef _concurrent_vector_first_
+#undef _concurrent_vector_buckets_
+#undef _concurrent_vector_bucket_size_
+#undef _concurrent_vector_bucket_of_
+#undef _concurrent_vector_offset_
+#undef _concurrent_vector_ready_
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/contenttype_undef.h"
+#include "c4c/internal/params/optchunkshift_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
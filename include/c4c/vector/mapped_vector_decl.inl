@@ -0,0 +1,206 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/**
+ * Container:
+ * 		Mapped vector.
+ *
+ * Brief description:
+ * 		Vector whose storage is a memory mapped file (mmap() on POSIX systems,
+ * 		CreateFileMapping() on Windows). Reopening an existing file maps it
+ * 		back as is: loading is zero-copy, pages are read lazily by the OS.
+ * 		The file starts with a small header recording the element size and the
+ * 		number of elements, followed by the elements themselves.
+ * 		Elements are persisted as raw bytes: use it for types without pointers
+ * 		and read files on the same architecture that wrote them.
+ *
+ * Supports allocators: NO
+ * Container type:      DYNAMIC (file backed)
+ *
+ * Features:
+ * - Random access by index (vec->data[index]).
+ * - Zero-copy open() of previously saved vectors.
+ * - sync() flushes the elements and the header to disk.
+ * - Grows by extending and remapping the file (vec->data can change after
+ *   every insertion, just like with a realloc()).
+ *
+ * @note On POSIX systems the implementation needs POSIX.1-2001 (ftruncate()).
+ *       mapped_vector_impl.inl defines _POSIX_C_SOURCE 200112L unless
+ *       _POSIX_C_SOURCE or _XOPEN_SOURCE already are, which is enough when
+ *       the mapped vector headers are the first ones included by the source
+ *       file. Otherwise, with a strict -std=c89/c99, system headers included
+ *       earlier already fixed the feature set: define _POSIX_C_SOURCE at the
+ *       top of the source file (or pass -D_POSIX_C_SOURCE=200112L).
+ */
+
+#include "c4c/internal/common_headers.h"
+
+#ifdef C4C_ALLOC_STATIC
+#  error The mapped vector is always backed by a file: C4C_ALLOC_STATIC is not supported.
+#endif
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+/*
+Parameters:
+
+#define C4C_PARAM_STRUCT_NAME 
+#define C4C_PARAM_PREFIX 
+#define C4C_PARAM_CONTENT_TYPE 
+#define C4C_PARAM_OPT_GROWTH
+*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/contenttype.h"
+
+/* Every growth remaps the file: grow geometrically by default. */
+#ifndef C4C_PARAM_OPT_GROWTH
+#  define C4C_PARAM_OPT_GROWTH C4C_GROWTH_2X
+#endif
+#include "c4c/internal/params/optgrowth.h"
+
+/*------------------------------------------------------------------------------
+	mapped vector struct definition
+------------------------------------------------------------------------------*/
+
+C4C_STRUCT_BEGIN(C4C_PARAM_STRUCT_NAME)
+	size_t size;
+	size_t capacity;
+	C4C_PARAM_CONTENT_TYPE* data;
+	void* map;
+	size_t map_size;
+#ifdef _WIN32
+	void* file;
+	void* mapping;
+#else
+	int fd;
+#endif
+C4C_STRUCT_END(C4C_PARAM_STRUCT_NAME)
+
+/*------------------------------------------------------------------------------
+	mapped vector functions
+------------------------------------------------------------------------------*/
+
+/**
+ * Open (or create) the file backing the mapped vector and map it. Existing
+ * files are mapped as they are (their elements are immediately available).
+ *
+ * @param vec       The mapped vector.
+ * @param path      The file's path.
+ * @param capacity  The initial capacity if the file has to be created.
+ *                  Ignored otherwise.
+ *
+ * @retval C4CE_INVALID_ARG  Capacity is an invalid number (zero?) or the file
+ *                           is not a mapped vector of the same element size.
+ * @retval C4CE_IO_FAIL      The file couldn't be opened, created or mapped.
+ * @retval C4CE_SUCCESS      Success.
+ */
+C4C_METHOD(c4c_res_t, open, C4C_THIS vec, const char* path, size_t capacity);
+
+/**
+ * Write the header and flush the mapped memory to disk. Blocks until the data
+ * has been written.
+ *
+ * @note Without sync() (or close()) the element count stored in the file is
+ *       not updated.
+ *
+ * @param vec  The mapped vector.
+ *
+ * @retval C4CE_IO_FAIL  The flush failed.
+ * @retval C4CE_SUCCESS  Success.
+ */
+C4C_METHOD(c4c_res_t, sync, C4C_THIS vec);
+
+/**
+ * Write the header, unmap and close the file. The mapped vector must be opened
+ * again before being used. Data is written back by the OS (call sync() first
+ * to wait for it). Does nothing if open() failed.
+ *
+ * @param vec  The mapped vector.
+ */
+C4C_METHOD(void, close, C4C_THIS vec);
+
+/**
+ * Make sure the mapped vector can hold at least the specified number of
+ * elements without further remapping (the file is extended accordingly).
+ *
+ * @param vec       The mapped vector.
+ * @param capacity  The minimum capacity.
+ *
+ * @retval C4CE_IO_FAIL   The file couldn't be extended or remapped. The vector
+ *                        is left untouched.
+ * @retval C4CE_SUCCESS   Success.
+ * @retval C4CEW_NOTHING  The mapped vector can already hold capacity elements.
+ */
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS vec, size_t capacity);
+
+/**
+ * Add an element at the end of the mapped vector.
+ *
+ * @param vec      The mapped vector.
+ * @param element  The element to add.
+ *
+ * @retval C4CE_IO_FAIL  The file couldn't be extended or remapped.
+ * @retval C4CE_SUCCESS  Success.
+ */
+C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element);
+
+/**
+ * Append n elements copied from an array.
+ *
+ * @param vec  The mapped vector.
+ * @param src  The elements to copy (must not point inside the vector).
+ * @param n    The number of elements to copy.
+ *
+ * @retval C4CE_IO_FAIL   The file couldn't be extended or remapped.
+ * @retval C4CE_SUCCESS   Success.
+ * @retval C4CEW_NOTHING  n is zero.
+ */
+C4C_METHOD(c4c_res_t, append_n, C4C_THIS vec, const C4C_PARAM_CONTENT_TYPE* src, size_t n);
+
+/**
+ * Remove the last element.
+ *
+ * @param vec  The mapped vector.
+ *
+ * @retval C4CE_EMPTY    The mapped vector is empty.
+ * @retval C4CE_SUCCESS  Success.
+ */
+C4C_METHOD(c4c_res_t, pop_back, C4C_THIS vec);
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/contenttype_undef.h"
+#include "c4c/internal/params/optgrowth_undef.h"
@@ -0,0 +1,358 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/* ftruncate() is POSIX.1-2001, strict -std=c89/c99 modes hide it. This must
+ * come before any system header (including the ones pulled in below). */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE) && !defined(_XOPEN_SOURCE)
+#  define _POSIX_C_SOURCE 200112L
+#endif
+
+#include "c4c/internal/common_headers.h"
+
+#include <stdint.h> /* for uint64_t */
+#include <string.h> /* for memcpy() */
+
+#ifdef _WIN32
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <sys/types.h>
+#  include <unistd.h>
+#endif
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/contenttype.h"
+
+#ifndef C4C_PARAM_OPT_GROWTH
+#  define C4C_PARAM_OPT_GROWTH C4C_GROWTH_2X
+#endif
+#include "c4c/internal/params/optgrowth.h"
+
+/*------------------------------------------------------------------------------
+    mapped vector static functions
+------------------------------------------------------------------------------*/
+
+/*
+ * File layout: a 64 bytes header (keeps the elements cache line aligned)
+ * made of uint64_t fields followed by the elements.
+ */
+#define _mapped_vector_header_size_ 64
+#define _mapped_vector_magic_ (((uint64_t)0x3156565Fu << 32) | 0x43344343u) /* "CC4C_VV1" */
+#define _mapped_vector_magic_idx_ 0
+#define _mapped_vector_elem_size_idx_ 1
+#define _mapped_vector_count_idx_ 2
+
+#define _mapped_vector_header_(vec) ((uint64_t*)(vec)->map)
+
+#define _mapped_vector_bytes_(capacity) \
+	(_mapped_vector_header_size_ + sizeof(C4C_PARAM_CONTENT_TYPE) * (capacity))
+
+/*
+ * Point the vector to a new mapping of 'bytes' bytes.
+ */
+C4C_METHOD_INLINE(void, attach_, C4C_THIS vec, void* map, size_t bytes)
+{
+	vec->map = map;
+	vec->map_size = bytes;
+	vec->data = (C4C_PARAM_CONTENT_TYPE*)((char*)map + _mapped_vector_header_size_);
+	vec->capacity = (bytes - _mapped_vector_header_size_) / sizeof(C4C_PARAM_CONTENT_TYPE);
+}
+
+#ifdef _WIN32
+
+/*
+ * Map the first 'bytes' bytes of the file (extending it if needed) then drop
+ * the previous mapping (if any). The old mapping is kept on failure.
+ */
+C4C_METHOD_INLINE(c4c_res_t, remap_, C4C_THIS vec, size_t bytes)
+{
+	HANDLE mapping;
+	void* map;
+	ULARGE_INTEGER size;
+	size.QuadPart = (ULONGLONG)bytes;
+	/* The mapping object extends the file to its size. */
+	mapping = CreateFileMappingA((HANDLE)vec->file, NULL, PAGE_READWRITE,
+		size.HighPart, size.LowPart, NULL);
+	if (!mapping)
+		return C4CE_IO_FAIL;
+	map = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, bytes);
+	if (!map) {
+		CloseHandle(mapping);
+		return C4CE_IO_FAIL;
+	}
+	if (vec->map) {
+		UnmapViewOfFile(vec->map);
+		CloseHandle((HANDLE)vec->mapping);
+	}
+	vec->mapping = mapping;
+	C4C_METHOD_INLINE_CALL(attach_, vec, map, bytes);
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD_INLINE(c4c_res_t, open_file_, C4C_THIS vec, const char* path, size_t* file_size)
+{
+	LARGE_INTEGER size;
+	HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ,
+		NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return C4CE_IO_FAIL;
+	if (!GetFileSizeEx(file, &size)) {
+		CloseHandle(file);
+		return C4CE_IO_FAIL;
+	}
+	vec->file = file;
+	vec->mapping = NULL;
+	*file_size = (size_t)size.QuadPart;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD_INLINE(void, close_file_, C4C_THIS vec)
+{
+	if (vec->map) {
+		UnmapViewOfFile(vec->map);
+		CloseHandle((HANDLE)vec->mapping);
+	}
+	CloseHandle((HANDLE)vec->file);
+	vec->file = NULL;
+	vec->mapping = NULL;
+}
+
+C4C_METHOD_INLINE(c4c_res_t, flush_, C4C_THIS vec)
+{
+	if (!FlushViewOfFile(vec->map, 0) || !FlushFileBuffers((HANDLE)vec->file))
+		return C4CE_IO_FAIL;
+	return C4CE_SUCCESS;
+}
+
+#else
+
+/* Largest file size off_t can hold (it is signed). */
+#define _mapped_vector_off_max_ \
+	((((uint64_t)1 << (sizeof(off_t) * 8 - 2)) - 1) * 2 + 1)
+
+C4C_METHOD_INLINE(c4c_res_t, remap_, C4C_THIS vec, size_t bytes)
+{
+	void* map;
+	/* Extend the file first: the old mapping stays valid meanwhile. */
+	if (bytes > vec->map_size) {
+		if ((uint64_t)bytes > _mapped_vector_off_max_ || ftruncate(vec->fd, (off_t)bytes) != 0)
+			return C4CE_IO_FAIL;
+	}
+	map = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, vec->fd, 0);
+	if (map == MAP_FAILED)
+		return C4CE_IO_FAIL;
+	if (vec->map)
+		munmap(vec->map, vec->map_size);
+	C4C_METHOD_INLINE_CALL(attach_, vec, map, bytes);
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD_INLINE(c4c_res_t, open_file_, C4C_THIS vec, const char* path, size_t* file_size)
+{
+	struct stat st;
+	int fd = open(path, O_RDWR | O_CREAT, 0644);
+	if (fd < 0)
+		return C4CE_IO_FAIL;
+	if (fstat(fd, &st) != 0) {
+		close(fd);
+		return C4CE_IO_FAIL;
+	}
+	vec->fd = fd;
+	*file_size = (size_t)st.st_size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD_INLINE(void, close_file_, C4C_THIS vec)
+{
+	if (vec->map)
+		munmap(vec->map, vec->map_size);
+	close(vec->fd);
+	vec->fd = -1;
+}
+
+C4C_METHOD_INLINE(c4c_res_t, flush_, C4C_THIS vec)
+{
+	if (msync(vec->map, vec->map_size, MS_SYNC) != 0)
+		return C4CE_IO_FAIL;
+	return C4CE_SUCCESS;
+}
+
+#endif /* _WIN32 */
+
+/*
+ * Make sure there is room for at least 'required' elements. If the vector has
+ * to grow, the new capacity is chosen by C4C_PARAM_OPT_GROWTH.
+ */
+C4C_METHOD_INLINE(c4c_res_t, grow_, C4C_THIS vec, size_t required)
+{
+	size_t capacity;
+	if (required <= vec->capacity)
+		return C4CE_SUCCESS;
+	capacity = (size_t)C4C_PARAM_OPT_GROWTH(vec->capacity);
+	if (capacity < required)
+		capacity = required;
+	return C4C_METHOD_INLINE_CALL(remap_, vec, _mapped_vector_bytes_(capacity));
+}
+
+/*------------------------------------------------------------------------------
+    mapped vector functions implementation
+------------------------------------------------------------------------------*/
+
+C4C_METHOD(c4c_res_t, open, C4C_THIS vec, const char* path, size_t capacity)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	size_t file_size;
+	uint64_t* header;
+	vec->size = 0;
+	vec->capacity = 0;
+	vec->data = NULL;
+	vec->map = NULL;
+	vec->map_size = 0;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(open_file_, vec, path, &file_size)))
+		return err;
+	if (file_size == 0) {
+		/* New file: write a fresh header. */
+		if (capacity == 0) {
+			C4C_METHOD_INLINE_CALL(close_file_, vec);
+			return C4CE_INVALID_ARG;
+		}
+		if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(remap_, vec, _mapped_vector_bytes_(capacity)))) {
+			C4C_METHOD_INLINE_CALL(close_file_, vec);
+			return err;
+		}
+		header = _mapped_vector_header_(vec);
+		header[_mapped_vector_magic_idx_] = _mapped_vector_magic_;
+		header[_mapped_vector_elem_size_idx_] = sizeof(C4C_PARAM_CONTENT_TYPE);
+		header[_mapped_vector_count_idx_] = 0;
+		return C4CE_SUCCESS;
+	}
+	if (file_size < _mapped_vector_bytes_(0)) {
+		C4C_METHOD_INLINE_CALL(close_file_, vec);
+		return C4CE_INVALID_ARG;
+	}
+	/* Existing file: map it as is. */
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(remap_, vec, file_size))) {
+		C4C_METHOD_INLINE_CALL(close_file_, vec);
+		return err;
+	}
+	header = _mapped_vector_header_(vec);
+	if (header[_mapped_vector_magic_idx_] != _mapped_vector_magic_ ||
+		header[_mapped_vector_elem_size_idx_] != sizeof(C4C_PARAM_CONTENT_TYPE) ||
+		header[_mapped_vector_count_idx_] > vec->capacity) {
+		C4C_METHOD_INLINE_CALL(close_file_, vec);
+		vec->map = NULL;
+		vec->data = NULL;
+		vec->capacity = 0;
+		return C4CE_INVALID_ARG;
+	}
+	vec->size = (size_t)header[_mapped_vector_count_idx_];
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, sync, C4C_THIS vec)
+{
+	_mapped_vector_header_(vec)[_mapped_vector_count_idx_] = vec->size;
+	return C4C_METHOD_INLINE_CALL(flush_, vec);
+}
+
+C4C_METHOD(void, close, C4C_THIS vec)
+{
+	/* A failed open() already closed the file. */
+	if (vec->map) {
+		_mapped_vector_header_(vec)[_mapped_vector_count_idx_] = vec->size;
+		C4C_METHOD_INLINE_CALL(close_file_, vec);
+	}
+	vec->size = 0;
+	vec->capacity = 0;
+	vec->data = NULL;
+	vec->map = NULL;
+	vec->map_size = 0;
+}
+
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS vec, size_t capacity)
+{
+	if (capacity <= vec->capacity)
+		return C4CEW_NOTHING;
+	return C4C_METHOD_INLINE_CALL(remap_, vec, _mapped_vector_bytes_(capacity));
+}
+
+C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + 1)))
+		return err;
+	vec->data[vec->size] = element;
+	++vec->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, append_n, C4C_THIS vec, const C4C_PARAM_CONTENT_TYPE* src, size_t n)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (n == 0)
+		return C4CEW_NOTHING;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + n)))
+		return err;
+	memcpy(vec->data + vec->size, src, sizeof(C4C_PARAM_CONTENT_TYPE) * n);
+	vec->size += n;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, pop_back, C4C_THIS vec)
+{
+	if (vec->size == 0)
+		return C4CE_EMPTY;
+	--vec->size;
+	return C4CE_SUCCESS;
+}
+
+/* undef static functions macros */
+#undef _mapped_vector_header_size_
+#undef _mapped_vector_magic_
+#undef _mapped_vector_magic_idx_
+#undef _mapped_vector_elem_size_idx_
+#undef _mapped_vector_count_idx_
+#undef _mapped_vector_header_
+#undef _mapped_vector_bytes_
+#undef _mapped_vector_off_max_
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/contenttype_undef.h"
+#include "c4c/internal/params/optgrowth_undef.h"
@@ -0,0 +1,183 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/**
+ * Container:
+ * 		Segmented vector.
+ *
+ * Brief description:
+ * 		Vector storing its elements in fixed size chunks (2^C4C_PARAM_OPT_CHUNK_SHIFT
+ * 		elements each) referenced by a chunk directory. Growing only allocates
+ * 		a new chunk: elements are never moved, so pointers to them stay valid
+ * 		and there are no realloc and copy stalls on huge vectors.
+ *
+ * Supports allocators: YES
+ * Container type:      DYNAMIC
+ *
+ * Features:
+ * - O(1) random access by index (one shift, one mask, two loads).
+ * - push/pop elements at the back.
+ * - Stable element addresses: an element stays where it is until popped.
+ * - Growth cost is bounded by one chunk allocation (plus a rare realloc of
+ *   the small chunk directory).
+ */
+
+#include "c4c/internal/allocators_decl.h"
+#include "c4c/internal/common_headers.h"
+
+#ifdef C4C_ALLOC_STATIC
+#  error The segmented vector allocates its chunks on demand: C4C_ALLOC_STATIC is not supported.
+#endif
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+/*
+Parameters:
+
+#define C4C_PARAM_STRUCT_NAME 
+#define C4C_PARAM_PREFIX 
+#define C4C_PARAM_CONTENT_TYPE 
+#define C4C_PARAM_OPT_CHUNK_SHIFT
+*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/contenttype.h"
+#include "c4c/internal/params/optchunkshift.h"
+
+/*------------------------------------------------------------------------------
+	segmented vector struct definition
+------------------------------------------------------------------------------*/
+
+C4C_STRUCT_BEGIN(C4C_PARAM_STRUCT_NAME)
+	size_t size;
+	size_t capacity;
+	C4C_PARAM_CONTENT_TYPE** chunks;
+	size_t chunks_count;
+	size_t chunks_capacity;
+C4C_STRUCT_END(C4C_PARAM_STRUCT_NAME)
+
+/*------------------------------------------------------------------------------
+	segmented vector functions
+------------------------------------------------------------------------------*/
+
+/**
+ * Initialize a new segmented vector.
+ *
+ * @param vec       The segmented vector.
+ * @param capacity  The initial capacity (rounded up to whole chunks). Can be
+ *                  zero: chunks are allocated upon insertion.
+ *
+ * @retval C4CE_MALLOC_FAIL   C4C_ALLOC() failed. Nothing is left allocated.
+ * @retval C4CE_REALLOC_FAIL  The chunk directory couldn't be allocated.
+ *                            Nothing is left allocated.
+ * @retval C4CE_SUCCESS       Success.
+ */
+C4C_METHOD(c4c_res_t, init, C4C_THIS vec, size_t capacity);
+
+/**
+ * Free the segmented vector's memory and prepare for new usage (must
+ * re-initialize first).
+ *
+ * @param vec  The segmented vector.
+ */
+C4C_METHOD(void, free, C4C_THIS vec);
+
+/**
+ * Make sure the segmented vector can hold at least the specified number of
+ * elements without further allocations.
+ *
+ * @param vec       The segmented vector.
+ * @param capacity  The minimum capacity (rounded up to whole chunks).
+ *
+ * @retval C4CE_MALLOC_FAIL   A chunk allocation failed. The chunks allocated
+ *                            so far are kept.
+ * @retval C4CE_REALLOC_FAIL  The chunk directory couldn't be expanded.
+ * @retval C4CE_SUCCESS       Success.
+ * @retval C4CEW_NOTHING      The segmented vector can already hold capacity
+ *                            elements.
+ */
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS vec, size_t capacity);
+
+/**
+ * Release the chunks not holding any element.
+ *
+ * @param vec  The segmented vector.
+ *
+ * @retval C4CE_SUCCESS   Success.
+ * @retval C4CEW_NOTHING  There were no empty chunks.
+ */
+C4C_METHOD(c4c_res_t, shrink_to_fit, C4C_THIS vec);
+
+/**
+ * Add an element at the end of the segmented vector. Other elements are never
+ * moved.
+ *
+ * @param vec      The segmented vector.
+ * @param element  The element to add.
+ *
+ * @retval C4CE_MALLOC_FAIL   The new chunk couldn't be allocated.
+ * @retval C4CE_REALLOC_FAIL  The chunk directory couldn't be expanded.
+ * @retval C4CE_SUCCESS       Success.
+ */
+C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element);
+
+/**
+ * Remove the last element. Its chunk is kept for further insertions (see
+ * shrink_to_fit()).
+ *
+ * @param vec  The segmented vector.
+ *
+ * @retval C4CE_EMPTY    The segmented vector is empty.
+ * @retval C4CE_SUCCESS  Success.
+ */
+C4C_METHOD(c4c_res_t, pop_back, C4C_THIS vec);
+
+/**
+ * Get the element at the specified index.
+ *
+ * @param vec    The segmented vector.
+ * @param index  The element's position.
+ *
+ * @return A pointer to the element (valid until the element is popped). NULL
+ *         if index >= size.
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, at, const C4C_THIS vec, size_t index);
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/contenttype_undef.h"
+#include "c4c/internal/params/optchunkshift_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
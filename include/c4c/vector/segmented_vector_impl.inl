@@ -0,0 +1,173 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include "c4c/internal/allocators_impl.h"
+#include "c4c/internal/common_headers.h"
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/contenttype.h"
+#include "c4c/internal/params/optchunkshift.h"
+
+/*------------------------------------------------------------------------------
+    segmented vector static functions
+------------------------------------------------------------------------------*/
+
+#define _segmented_vector_chunk_size_ ((size_t)1 << C4C_PARAM_OPT_CHUNK_SHIFT)
+#define _segmented_vector_chunk_mask_ (_segmented_vector_chunk_size_ - 1)
+
+/*
+ * Allocate a new chunk at the end of the directory (doubling the directory if
+ * full).
+ */
+C4C_METHOD_INLINE(c4c_res_t, add_chunk_, C4C_THIS vec)
+{
+	C4C_PARAM_CONTENT_TYPE** chunks;
+	C4C_PARAM_CONTENT_TYPE* chunk;
+	size_t chunks_capacity;
+	if (vec->chunks_count == vec->chunks_capacity) {
+		chunks_capacity = vec->chunks_capacity ? vec->chunks_capacity * 2 : 8;
+		chunks = C4C_REALLOC(vec->chunks, sizeof(C4C_PARAM_CONTENT_TYPE*) * chunks_capacity);
+		if (!chunks)
+			return C4CE_REALLOC_FAIL;
+		vec->chunks = chunks;
+		vec->chunks_capacity = chunks_capacity;
+	}
+	chunk = C4C_ALLOC(sizeof(C4C_PARAM_CONTENT_TYPE) * _segmented_vector_chunk_size_);
+	if (!chunk)
+		return C4CE_MALLOC_FAIL;
+	vec->chunks[vec->chunks_count] = chunk;
+	++vec->chunks_count;
+	vec->capacity += _segmented_vector_chunk_size_;
+	return C4CE_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+    segmented vector functions implementation
+------------------------------------------------------------------------------*/
+
+C4C_METHOD(c4c_res_t, init, C4C_THIS vec, size_t capacity)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	vec->size = 0;
+	vec->capacity = 0;
+	vec->chunks = NULL;
+	vec->chunks_count = 0;
+	vec->chunks_capacity = 0;
+	if (capacity == 0)
+		return C4CE_SUCCESS;
+	if (!c4c_succeeded(err = C4C_METHOD_CALL(reserve, vec, capacity))) {
+		C4C_METHOD_CALL(free, vec);
+		return err;
+	}
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(void, free, C4C_THIS vec)
+{
+	size_t i;
+	for (i = 0; i < vec->chunks_count; ++i)
+		C4C_FREE(vec->chunks[i]);
+	C4C_FREE(vec->chunks);
+	vec->size = 0;
+	vec->capacity = 0;
+	vec->chunks = NULL;
+	vec->chunks_count = 0;
+	vec->chunks_capacity = 0;
+}
+
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS vec, size_t capacity)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (capacity <= vec->capacity)
+		return C4CEW_NOTHING;
+	while (vec->capacity < capacity) {
+		if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(add_chunk_, vec)))
+			return err;
+	}
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, shrink_to_fit, C4C_THIS vec)
+{
+	size_t used = (vec->size + _segmented_vector_chunk_mask_) >> C4C_PARAM_OPT_CHUNK_SHIFT;
+	if (vec->chunks_count == used)
+		return C4CEW_NOTHING;
+	while (vec->chunks_count > used) {
+		--vec->chunks_count;
+		C4C_FREE(vec->chunks[vec->chunks_count]);
+	}
+	vec->capacity = used << C4C_PARAM_OPT_CHUNK_SHIFT;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (vec->size == vec->capacity) {
+		if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(add_chunk_, vec)))
+			return err;
+	}
+	vec->chunks[vec->size >> C4C_PARAM_OPT_CHUNK_SHIFT][vec->size & _segmented_vector_chunk_mask_] = element;
+	++vec->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, pop_back, C4C_THIS vec)
+{
+	if (vec->size == 0)
+		return C4CE_EMPTY;
+	--vec->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, at, const C4C_THIS vec, size_t index)
+{
+	if (index >= vec->size)
+		return NULL;
+	return &vec->chunks[index >> C4C_PARAM_OPT_CHUNK_SHIFT][index & _segmented_vector_chunk_mask_];
+}
+
+/* undef static functions macros */
+#undef _segmented_vector_chunk_size_
+#undef _segmented_vector_chunk_mask_
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/contenttype_undef.h"
+#include "c4c/internal/params/optchunkshift_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
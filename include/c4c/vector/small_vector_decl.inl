@@ -0,0 +1,376 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/**
+ * Container:
+ * 		Small vector.
+ *
+ * Brief description:
+ * 		Same interface as the dynamic vector (see vector_decl.inl) but the first
+ * 		C4C_PARAM_INLINE_CAPACITY elements are stored inside the struct itself.
+ * 		The heap is used only when the vector grows past that size, making it
+ * 		ideal for the (very common) vectors that almost always hold just a few
+ * 		elements.
+ *
+ * Supports allocators: YES
+ * Container type:      DYNAMIC
+ *
+ * Features:
+ * - Random access by index.
+ * - No heap allocation at all as long as size <= C4C_PARAM_INLINE_CAPACITY.
+ * - Spills to the heap (and back with shrink_to_fit()) transparently.
+ * - Same methods (and semantics) as the dynamic vector.
+ *
+ * @warning The struct points into itself while the elements are stored
+ *          inline: NEVER copy/move it by value (memcpy(), assignment, return
+ *          by value etc...). Use copy() instead.
+ */
+
+#include "c4c/internal/allocators_decl.h"
+#include "c4c/internal/common_headers.h"
+
+#ifdef C4C_ALLOC_STATIC
+#  error C4C_ALLOC_STATIC is not supported by the small vector (use the vector instead).
+#endif
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+/*
+Parameters:
+
+#define C4C_PARAM_STRUCT_NAME 
+#define C4C_PARAM_PREFIX 
+#define C4C_PARAM_CONTENT_TYPE 
+#define C4C_PARAM_INLINE_CAPACITY 
+#define C4C_PARAM_OPT_GROWTH
+#define C4C_PARAM_OPT_TRIVIAL
+*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/contenttype.h"
+#include "c4c/internal/params/inlinecapacity.h"
+#include "c4c/internal/params/optgrowth.h"
+#include "c4c/internal/params/opttrivial.h"
+
+/*------------------------------------------------------------------------------
+	small vector struct definition
+------------------------------------------------------------------------------*/
+
+C4C_STRUCT_BEGIN(C4C_PARAM_STRUCT_NAME)
+	size_t size;
+	size_t capacity;
+	C4C_PARAM_CONTENT_TYPE* data;
+	C4C_PARAM_CONTENT_TYPE inline_data[C4C_PARAM_INLINE_CAPACITY];
+C4C_STRUCT_END(C4C_PARAM_STRUCT_NAME)
+
+/*------------------------------------------------------------------------------
+	small vector functions
+------------------------------------------------------------------------------*/
+
+/**
+ * Initialize a new small vector.
+ *
+ * @param vec       The vector.
+ * @param capacity  The vector initial capacity. If less than or equal to
+ *                  C4C_PARAM_INLINE_CAPACITY no allocation is performed.
+ *
+ * @retval C4CE_MALLOC_FAIL  C4C_ALLOC() failed. The vector is still usable with
+ *                           the inline capacity.
+ * @retval C4CE_SUCCESS      Success.
+ */
+C4C_METHOD(c4c_res_t, init, C4C_THIS vec, size_t capacity);
+
+/**
+ * Free the vector's heap memory (if any) and empty it. The vector can be used
+ * again right away with the inline capacity.
+ *
+ * @param vec  The vector.
+ */
+C4C_METHOD(void, free, C4C_THIS vec);
+
+/**
+ * Resize the vector. Either shrink or grow (return value may change).
+ *
+ * @note The capacity never goes below C4C_PARAM_INLINE_CAPACITY. Shrinking
+ *       below it moves the elements back into the inline storage.
+ *
+ * @param vec       The vector.
+ * @param capacity  The new capacity.
+ *
+ * @retval C4CE_INVALID_ARG       Capacity is zero.
+ * @retval C4CE_MALLOC_FAIL       Memory allocation failed. The vector is left
+ *                                untouched.
+ * @retval C4CE_REALLOC_FAIL      Memory reallocation failed. The vector is left
+ *                                untouched.
+ * @retval C4CE_SUCCESS           Success.
+ * @retval C4CEW_ELEMS_DISCARDED  Success but, due to the shrinking of the
+ *                                vector, some elements were discarded.
+ * @retval C4CEW_NOTHING          The new capacity is the same as the current one.
+ */
+C4C_METHOD(c4c_res_t, resize, C4C_THIS vec, size_t capacity);
+
+/**
+ * Make sure the vector can hold at least the specified number of elements
+ * without further reallocations. Never shrinks the vector.
+ *
+ * @param vec       The vector.
+ * @param capacity  The minimum capacity.
+ *
+ * @retval resize()'s     error codes.
+ * @retval C4CE_SUCCESS   Success.
+ * @retval C4CEW_NOTHING  The vector can already hold capacity elements.
+ */
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS vec, size_t capacity);
+
+/**
+ * Release the unused capacity. Moves the elements back into the inline storage
+ * if they fit.
+ *
+ * @param vec  The vector.
+ *
+ * @retval resize()'s     error codes.
+ * @retval C4CE_SUCCESS   Success.
+ * @retval C4CEW_NOTHING  There is no unused capacity to release.
+ */
+C4C_METHOD(c4c_res_t, shrink_to_fit, C4C_THIS vec);
+
+/**
+ * Copy the entire content of the first vector into the second one. Resize if
+ * neccesary.
+ *
+ * @param from  The source vector.
+ * @param to    The destination vector.
+ *
+ * @retval C4CE_SUCCESS  Success.
+ * @retval resize()'s    error codes.
+ */
+C4C_METHOD(c4c_res_t, copy, const C4C_THIS from, C4C_THIS to);
+
+/**
+ * Insert a new element at the end of the vector growing it if needed (following
+ * C4C_PARAM_OPT_GROWTH).
+ *
+ * @param vec      The vector.
+ * @param element  The element to add.
+ *
+ * @retval resize()'s    error codes.
+ * @retval C4CE_SUCCESS  Success.
+ */
+C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element);
+
+/**
+ * Insert a new uninitialized element at the end of the vector and return a
+ * pointer to it so that it can be constructed in place (no copies).
+ *
+ * @warning The pointer is invalidated by the next operation that grows the
+ *          vector.
+ *
+ * @param vec  The vector.
+ *
+ * @return The new element. NULL if the vector couldn't grow.
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, emplace_back, C4C_THIS vec);
+
+/**
+ * Insert a new element at the specified index position. The old element at the
+ * index position will end up at the end of the vector.
+ *
+ * @param vec      The vector.
+ * @param element  The element to add.
+ * @param index    Where to add the new element.
+ *
+ * @retval C4CE_INDEX_OUT_OF_BOUNDS  Index is out of bounds (index > size).
+ * @retval resize()'s                error codes.
+ * @retval C4CE_SUCCESS              Success.
+ */
+C4C_METHOD(c4c_res_t, push_at, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element, size_t index);
+
+/**
+ * Insert a new uninitialized element at the specified index position and return
+ * a pointer to it. Like push_at() the old element at the index position is
+ * moved to the end of the vector.
+ *
+ * @warning The pointer is invalidated by the next operation that grows the
+ *          vector.
+ *
+ * @param vec    The vector.
+ * @param index  Where to add the new element (index <= size).
+ *
+ * @return The new element. NULL if index is out of bounds or the vector
+ *         couldn't grow.
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, emplace_at, C4C_THIS vec, size_t index);
+
+/**
+ * Insert a new element at the specified index position preserving the order
+ * of the other elements.
+ *
+ * @param vec      The vector.
+ * @param element  The element to add.
+ * @param index    Where to add the new element (index <= size).
+ *
+ * @retval C4CE_INDEX_OUT_OF_BOUNDS  Index is out of bounds (index > size).
+ * @retval resize()'s                error codes.
+ * @retval C4CE_SUCCESS              Success.
+ */
+C4C_METHOD(c4c_res_t, insert_stable, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element, size_t index);
+
+/**
+ * Insert n elements at the end of the vector growing it (at most) once.
+ *
+ * @warning src must not point inside the vector itself.
+ *
+ * @param vec  The vector.
+ * @param src  The elements to add.
+ * @param n    The number of elements to add.
+ *
+ * @retval resize()'s     error codes.
+ * @retval C4CE_SUCCESS   Success.
+ * @retval C4CEW_NOTHING  n is zero.
+ */
+C4C_METHOD(c4c_res_t, append_n, C4C_THIS vec, const C4C_PARAM_CONTENT_TYPE* src, size_t n);
+
+/**
+ * Insert n elements at the specified index position growing the vector (at
+ * most) once and preserving the order of the other elements.
+ *
+ * @warning src must not point inside the vector itself.
+ *
+ * @param vec    The vector.
+ * @param index  Where to add the first new element (index <= size).
+ * @param src    The elements to add.
+ * @param n      The number of elements to add.
+ *
+ * @retval C4CE_INDEX_OUT_OF_BOUNDS  Index is out of bounds (index > size).
+ * @retval resize()'s                error codes.
+ * @retval C4CE_SUCCESS              Success.
+ * @retval C4CEW_NOTHING             n is zero.
+ */
+C4C_METHOD(c4c_res_t, insert_range, C4C_THIS vec, size_t index, const C4C_PARAM_CONTENT_TYPE* src, size_t n);
+
+/**
+ * Replace the whole content of the vector with n elements.
+ *
+ * @warning src must not point inside the vector itself.
+ *
+ * @param vec  The vector.
+ * @param src  The new elements.
+ * @param n    The number of elements.
+ *
+ * @retval resize()'s    error codes. The vector is left untouched.
+ * @retval C4CE_SUCCESS  Success.
+ */
+C4C_METHOD(c4c_res_t, assign, C4C_THIS vec, const C4C_PARAM_CONTENT_TYPE* src, size_t n);
+
+/**
+ * Remove the last element of the vector.
+ *
+ * @param vec  The vector.
+ *
+ * @retval C4CE_EMPTY    The vector is already empty.
+ * @retval C4CE_SUCCESS  Success.
+ */
+C4C_METHOD(c4c_res_t, pop_back, C4C_THIS vec);
+
+/**
+ * Remove the element at the specified index position replacing it with the
+ * last one.
+ *
+ * @param vec    The vector.
+ * @param index  The position of the element to remove.
+ *
+ * @retval C4CE_EMPTY                The vector is already empty.
+ * @retval C4CE_INDEX_OUT_OF_BOUNDS  Index is out of bounds (index >= size).
+ * @retval C4CE_SUCCESS              Success.
+ */
+C4C_METHOD(c4c_res_t, pop_at, C4C_THIS vec, size_t index);
+
+/**
+ * Remove the element at the specified index position preserving the order of
+ * the other elements.
+ *
+ * @param vec    The vector.
+ * @param index  The position of the element to remove.
+ *
+ * @retval C4CE_EMPTY                The vector is already empty.
+ * @retval C4CE_INDEX_OUT_OF_BOUNDS  Index is out of bounds (index >= size).
+ * @retval C4CE_SUCCESS              Success.
+ */
+C4C_METHOD(c4c_res_t, erase_stable, C4C_THIS vec, size_t index);
+
+/**
+ * Remove the elements in the range [first, last) preserving the order of the
+ * other elements.
+ *
+ * @param vec    The vector.
+ * @param first  The position of the first element to remove.
+ * @param last   The position following the last element to remove.
+ *
+ * @retval C4CE_INVALID_ARG          first > last.
+ * @retval C4CE_INDEX_OUT_OF_BOUNDS  The range is out of bounds (last > size).
+ * @retval C4CE_SUCCESS              Success.
+ * @retval C4CEW_NOTHING             The range is empty (first == last).
+ */
+C4C_METHOD(c4c_res_t, erase_range, C4C_THIS vec, size_t first, size_t last);
+
+/**
+ * Get the last element of the vector.
+ *
+ * @param vec  The vector.
+ *
+ * @return The last element. NULL if the vector is empty.
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, back, C4C_THIS vec);
+
+/**
+ * Test whether the elements are currently stored inside the struct.
+ *
+ * @param vec  The vector.
+ *
+ * @return 1 if no heap memory is in use. 0 otherwise.
+ */
+C4C_METHOD_INLINE(int, is_inline, const C4C_THIS vec)
+{
+	return vec->data == vec->inline_data;
+}
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/contenttype_undef.h"
+#include "c4c/internal/params/inlinecapacity_undef.h"
+#include "c4c/internal/params/optgrowth_undef.h"
+#include "c4c/internal/params/opttrivial_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
@@ -0,0 +1,351 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include "c4c/internal/allocators_impl.h"
+#include "c4c/internal/common_headers.h"
+
+#include <string.h> /* for memcpy(), memmove() */
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/contenttype.h"
+#include "c4c/internal/params/inlinecapacity.h"
+#include "c4c/internal/params/optgrowth.h"
+#include "c4c/internal/params/opttrivial.h"
+
+/*------------------------------------------------------------------------------
+    small vector static functions
+------------------------------------------------------------------------------*/
+
+#if C4C_PARAM_OPT_TRIVIAL
+
+/*
+ * Copy n elements between two non overlapping blocks.
+ */
+#define _vector_copy_(dst, src, n) \
+	memcpy((dst), (src), sizeof(C4C_PARAM_CONTENT_TYPE) * (n))
+
+/*
+ * Copy n elements between two (possibly) overlapping blocks.
+ */
+#define _vector_move_(dst, src, n) \
+	memmove((dst), (src), sizeof(C4C_PARAM_CONTENT_TYPE) * (n))
+
+#else
+
+#define _vector_copy_(dst, src, n) \
+	do { \
+		size_t __i; \
+		for (__i = 0; __i < (n); ++__i) \
+			(dst)[__i] = (src)[__i]; \
+	} while (0)
+
+#define _vector_move_(dst, src, n) \
+	do { \
+		size_t __i; \
+		if ((dst) < (src)) { \
+			for (__i = 0; __i < (n); ++__i) \
+				(dst)[__i] = (src)[__i]; \
+		} else { \
+			for (__i = (n); __i > 0; --__i) \
+				(dst)[__i - 1] = (src)[__i - 1]; \
+		} \
+	} while (0)
+
+#endif /* C4C_PARAM_OPT_TRIVIAL */
+
+/*
+ * Make sure there is room for at least 'required' elements. If the vector has
+ * to grow, the new capacity is chosen by C4C_PARAM_OPT_GROWTH.
+ */
+C4C_METHOD_INLINE(c4c_res_t, grow_, C4C_THIS vec, size_t required)
+{
+	size_t capacity;
+	if (required <= vec->capacity)
+		return C4CE_SUCCESS;
+	capacity = (size_t)C4C_PARAM_OPT_GROWTH(vec->capacity);
+	if (capacity < required)
+		capacity = required;
+	return C4C_METHOD_CALL(resize, vec, capacity);
+}
+
+/*------------------------------------------------------------------------------
+    small vector functions implementation
+------------------------------------------------------------------------------*/
+
+C4C_METHOD(c4c_res_t, init, C4C_THIS vec, size_t capacity)
+{
+	vec->size = 0;
+	vec->capacity = C4C_PARAM_INLINE_CAPACITY;
+	vec->data = vec->inline_data;
+	if (capacity > C4C_PARAM_INLINE_CAPACITY)
+		return C4C_METHOD_CALL(resize, vec, capacity);
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(void, free, C4C_THIS vec)
+{
+	if (vec->data != vec->inline_data)
+		C4C_FREE(vec->data);
+	vec->size = 0;
+	vec->capacity = C4C_PARAM_INLINE_CAPACITY;
+	vec->data = vec->inline_data;
+}
+
+C4C_METHOD(c4c_res_t, resize, C4C_THIS vec, size_t capacity)
+{
+	C4C_PARAM_CONTENT_TYPE* data;
+	size_t size = vec->size;
+	if (capacity == 0)
+		return C4CE_INVALID_ARG;
+	if (size > capacity)
+		size = capacity;
+	if (capacity < C4C_PARAM_INLINE_CAPACITY)
+		capacity = C4C_PARAM_INLINE_CAPACITY;
+	if (capacity == vec->capacity) {
+		if (size == vec->size)
+			return C4CEW_NOTHING;
+		vec->size = size;
+		return C4CEW_ELEMS_DISCARDED;
+	}
+	if (capacity == C4C_PARAM_INLINE_CAPACITY) {
+		/* Move the elements back inside the struct. */
+		_vector_copy_(vec->inline_data, vec->data, size);
+		C4C_FREE(vec->data);
+		data = vec->inline_data;
+	} else if (vec->data == vec->inline_data) {
+		/* Spill the elements to the heap. */
+		data = C4C_ALLOC(sizeof(C4C_PARAM_CONTENT_TYPE) * capacity);
+		if (!data)
+			return C4CE_MALLOC_FAIL;
+		_vector_copy_(data, vec->inline_data, size);
+	} else {
+		data = C4C_REALLOC(vec->data, sizeof(C4C_PARAM_CONTENT_TYPE) * capacity);
+		if (!data)
+			return C4CE_REALLOC_FAIL;
+	}
+	vec->data = data;
+	vec->capacity = capacity;
+	if (size != vec->size) {
+		vec->size = size;
+		return C4CEW_ELEMS_DISCARDED;
+	}
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS vec, size_t capacity)
+{
+	if (capacity <= vec->capacity)
+		return C4CEW_NOTHING;
+	return C4C_METHOD_CALL(resize, vec, capacity);
+}
+
+C4C_METHOD(c4c_res_t, shrink_to_fit, C4C_THIS vec)
+{
+	return C4C_METHOD_CALL(resize, vec, vec->size > 0 ? vec->size : 1);
+}
+
+C4C_METHOD(c4c_res_t, copy, const C4C_THIS from, C4C_THIS to)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (from == to)
+		return C4CE_SUCCESS;
+	err = C4C_METHOD_CALL(reserve, to, from->size);
+	if (!c4c_succeeded(err))
+		return err;
+	if (from->size != 0)
+		_vector_copy_(to->data, from->data, from->size);
+	to->size = from->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + 1)))
+		return err;
+	vec->data[vec->size] = element;
+	++vec->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, emplace_back, C4C_THIS vec)
+{
+	if (!c4c_succeeded(C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + 1)))
+		return NULL;
+	++vec->size;
+	return vec->data + (vec->size - 1);
+}
+
+C4C_METHOD(c4c_res_t, push_at, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element, size_t index)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (index > vec->size)
+		return C4CE_INDEX_OUT_OF_BOUNDS;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + 1)))
+		return err;
+	/* Move the element at the specified index to the new last place the insert
+	 * the new element in the right spot. */
+	vec->data[vec->size] = vec->data[index];
+	vec->data[index] = element;
+	++vec->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, emplace_at, C4C_THIS vec, size_t index)
+{
+	if (index > vec->size)
+		return NULL;
+	if (!c4c_succeeded(C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + 1)))
+		return NULL;
+	vec->data[vec->size] = vec->data[index];
+	++vec->size;
+	return vec->data + index;
+}
+
+C4C_METHOD(c4c_res_t, insert_stable, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element, size_t index)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (index > vec->size)
+		return C4CE_INDEX_OUT_OF_BOUNDS;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + 1)))
+		return err;
+	_vector_move_(vec->data + index + 1, vec->data + index, vec->size - index);
+	vec->data[index] = element;
+	++vec->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, append_n, C4C_THIS vec, const C4C_PARAM_CONTENT_TYPE* src, size_t n)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (n == 0)
+		return C4CEW_NOTHING;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + n)))
+		return err;
+	_vector_copy_(vec->data + vec->size, src, n);
+	vec->size += n;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, insert_range, C4C_THIS vec, size_t index, const C4C_PARAM_CONTENT_TYPE* src, size_t n)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (index > vec->size)
+		return C4CE_INDEX_OUT_OF_BOUNDS;
+	if (n == 0)
+		return C4CEW_NOTHING;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + n)))
+		return err;
+	/* Open a gap of n elements at index then fill it. */
+	_vector_move_(vec->data + index + n, vec->data + index, vec->size - index);
+	_vector_copy_(vec->data + index, src, n);
+	vec->size += n;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, assign, C4C_THIS vec, const C4C_PARAM_CONTENT_TYPE* src, size_t n)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, n)))
+		return err;
+	if (n != 0)
+		_vector_copy_(vec->data, src, n);
+	vec->size = n;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, pop_back, C4C_THIS vec)
+{
+	if (vec->size == 0)
+		return C4CE_EMPTY;
+	--vec->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, pop_at, C4C_THIS vec, size_t index)
+{
+	if (vec->size == 0)
+		return C4CE_EMPTY;
+	if (index >= vec->size)
+		return C4CE_INDEX_OUT_OF_BOUNDS;
+	/* Replace the element to 'remove' with the last one, then decrement size. */
+	vec->data[index] = vec->data[vec->size - 1];
+	--vec->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, erase_stable, C4C_THIS vec, size_t index)
+{
+	if (vec->size == 0)
+		return C4CE_EMPTY;
+	if (index >= vec->size)
+		return C4CE_INDEX_OUT_OF_BOUNDS;
+	_vector_move_(vec->data + index, vec->data + index + 1, vec->size - index - 1);
+	--vec->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, erase_range, C4C_THIS vec, size_t first, size_t last)
+{
+	if (first > last)
+		return C4CE_INVALID_ARG;
+	if (last > vec->size)
+		return C4CE_INDEX_OUT_OF_BOUNDS;
+	if (first == last)
+		return C4CEW_NOTHING;
+	_vector_move_(vec->data + first, vec->data + last, vec->size - last);
+	vec->size -= last - first;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, back, C4C_THIS vec)
+{
+	return vec->size != 0 ? vec->data + (vec->size - 1) : NULL;
+}
+
+/* undef static functions macros */
+#undef _vector_copy_
+#undef _vector_move_
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/contenttype_undef.h"
+#include "c4c/internal/params/inlinecapacity_undef.h"
+#include "c4c/internal/params/optgrowth_undef.h"
+#include "c4c/internal/params/opttrivial_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
@@ -0,0 +1,206 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+/**
+ * Container:
+ * 		Struct of arrays vector.
+ *
+ * Brief description:
+ * 		Vector storing every field of its elements in a separate contiguous
+ * 		array (struct of arrays) instead of an array of structs. Loops touching
+ * 		only a few fields of wide elements read only the memory they need and
+ * 		are trivially vectorizable.
+ * 		Fields are declared with an X-macro (see C4C_PARAM_FIELDS).
+ *
+ * Supports allocators: YES
+ * Container type:      STATIC/DYNAMIC
+ *
+ * Features:
+ * - One array per field: vec->field[index] (or <prefix>_<field>(vec)).
+ * - Random access by index.
+ * - Resizable (if dynamic) with a customizable growth policy.
+ * - push_back() receives the fields as separate arguments.
+ * - Extremely fast elements deletion (the last element takes the removed
+ *   one's place, just like the vector's pop_at()).
+ */
+
+#include "c4c/internal/allocators_decl.h"
+#include "c4c/internal/common_headers.h"
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+/*
+Parameters:
+
+#define C4C_PARAM_STRUCT_NAME 
+#define C4C_PARAM_PREFIX 
+#define C4C_PARAM_FIELDS 
+#define C4C_PARAM_OPT_GROWTH
+*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/fields.h"
+#include "c4c/internal/params/optgrowth.h"
+
+/*------------------------------------------------------------------------------
+	soa vector struct definition
+------------------------------------------------------------------------------*/
+
+#define _soa_vector_member_(type, name) C4C_RAW_ARRAY(type, name);
+
+C4C_STRUCT_BEGIN(C4C_PARAM_STRUCT_NAME)
+	size_t size;
+	size_t capacity;
+	C4C_PARAM_FIELDS(_soa_vector_member_)
+C4C_STRUCT_END(C4C_PARAM_STRUCT_NAME)
+
+/*------------------------------------------------------------------------------
+	soa vector functions
+------------------------------------------------------------------------------*/
+
+#define _soa_vector_param_(type, name) , type name
+#define _soa_vector_accessor_(type, name) C4C_METHOD(type*, name, C4C_THIS vec);
+
+/**
+ * Initialize a new soa vector.
+ *
+ * @param vec       The soa vector.
+ * @param capacity  The initial capacity. Ignored if C4C_ALLOC_STATIC has been
+ *                  defined.
+ *
+ * @retval C4CE_INVALID_ARG  Capacity is an invalid number (zero?). No
+ *                           allocation has been performed.
+ * @retval C4CE_MALLOC_FAIL  C4C_ALLOC() failed for one of the fields. Nothing
+ *                           is left allocated.
+ * @retval C4CE_SUCCESS      Success.
+ */
+C4C_METHOD(c4c_res_t, init, C4C_THIS vec, size_t capacity);
+
+/**
+ * Free the soa vector's memory and prepare for new usage (must re-initialize
+ * first).
+ *
+ * @param vec  The soa vector.
+ */
+C4C_METHOD(void, free, C4C_THIS vec);
+
+/**
+ * Resize every field array.
+ *
+ * @param vec       The soa vector.
+ * @param capacity  The new capacity.
+ *
+ * @retval C4CE_CANT_DO           C4C_ALLOC_STATIC has been defined.
+ * @retval C4CE_INVALID_ARG       Capacity is an invalid number (zero?).
+ * @retval C4CE_REALLOC_FAIL      Memory reallocation failed for one of the
+ *                                fields. When growing the vector is left
+ *                                untouched, when shrinking the capacity (and
+ *                                size) are reduced anyway.
+ * @retval C4CE_SUCCESS           Success.
+ * @retval C4CEW_NOTHING          capacity is equal to the current one.
+ * @retval C4CEW_ELEMS_DISCARDED  The new capacity is less than size: the
+ *                                exceeding elements were discarded.
+ */
+C4C_METHOD(c4c_res_t, resize, C4C_THIS vec, size_t capacity);
+
+/**
+ * Make sure the soa vector can hold at least the specified number of elements
+ * without further reallocations.
+ *
+ * @param vec       The soa vector.
+ * @param capacity  The minimum capacity.
+ *
+ * @retval C4CE_CANT_DO       C4C_ALLOC_STATIC is defined and capacity is
+ *                            greater than the static capacity.
+ * @retval C4CE_REALLOC_FAIL  Memory reallocation failed.
+ * @retval C4CE_SUCCESS       Success.
+ * @retval C4CEW_NOTHING      The soa vector can already hold capacity
+ *                            elements.
+ */
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS vec, size_t capacity);
+
+/**
+ * Add an element at the end of the soa vector. Receives one argument per
+ * field, in the same order as C4C_PARAM_FIELDS.
+ *
+ * @param vec  The soa vector.
+ * @param ...  The element's fields.
+ *
+ * @retval C4CE_FULL          The soa vector is full and can't be expanded
+ *                            (C4C_ALLOC_STATIC has been defined).
+ * @retval C4CE_REALLOC_FAIL  Memory reallocation failed.
+ * @retval C4CE_SUCCESS       Success.
+ */
+C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec C4C_PARAM_FIELDS(_soa_vector_param_));
+
+/**
+ * Remove the last element.
+ *
+ * @param vec  The soa vector.
+ *
+ * @retval C4CE_EMPTY    The soa vector is empty.
+ * @retval C4CE_SUCCESS  Success.
+ */
+C4C_METHOD(c4c_res_t, pop_back, C4C_THIS vec);
+
+/**
+ * Remove the element at the specified index. The last element takes its
+ * place.
+ *
+ * @param vec    The soa vector.
+ * @param index  The position of the element to remove.
+ *
+ * @retval C4CE_EMPTY                The soa vector is empty.
+ * @retval C4CE_INDEX_OUT_OF_BOUNDS  Index is out of bounds (index >= size).
+ * @retval C4CE_SUCCESS              Success.
+ */
+C4C_METHOD(c4c_res_t, pop_at, C4C_THIS vec, size_t index);
+
+/**
+ * Per field accessors: <prefix>_<field>(vec) returns the field's array (size
+ * elements long). Handy to hand a single column to other functions.
+ */
+C4C_PARAM_FIELDS(_soa_vector_accessor_)
+
+#undef _soa_vector_member_
+#undef _soa_vector_param_
+#undef _soa_vector_accessor_
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/fields_undef.h"
+#include "c4c/internal/params/optgrowth_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
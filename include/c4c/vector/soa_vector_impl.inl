@@ -0,0 +1,232 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 Andrea Vouk.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * This file is part of the C4C library (https://github.com/QwertyQaz414/C4C).
+ */
+
+#include "c4c/internal/allocators_impl.h"
+#include "c4c/internal/common_headers.h"
+
+/*------------------------------------------------------------------------------
+	params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/params/default.h"
+#include "c4c/internal/params/fields.h"
+#include "c4c/internal/params/optgrowth.h"
+
+/*------------------------------------------------------------------------------
+    soa vector static functions
+------------------------------------------------------------------------------*/
+
+/*
+ * Per field statements, expanded through C4C_PARAM_FIELDS.
+ */
+#define _soa_vector_alloc_(type, name) \
+	vec->name = C4C_ALLOC(sizeof(type) * capacity); \
+	if (!vec->name) \
+		failed = 1;
+
+#define _soa_vector_null_(type, name) \
+	vec->name = NULL;
+
+#define _soa_vector_free_(type, name) \
+	C4C_FREE(vec->name); \
+	vec->name = NULL;
+
+#define _soa_vector_realloc_(type, name) \
+	if (!failed) { \
+		type* __data = C4C_REALLOC(vec->name, sizeof(type) * capacity); \
+		if (__data) \
+			vec->name = __data; \
+		else \
+			failed = 1; \
+	}
+
+#define _soa_vector_store_(type, name) \
+	vec->name[vec->size] = name;
+
+#define _soa_vector_take_last_(type, name) \
+	vec->name[index] = vec->name[vec->size - 1];
+
+#define _soa_vector_param_(type, name) , type name
+
+#define _soa_vector_accessor_(type, name) \
+	C4C_METHOD(type*, name, C4C_THIS vec) \
+	{ \
+		return vec->name; \
+	}
+
+/*
+ * Make sure there is room for at least 'required' elements. If the vector has
+ * to grow, the new capacity is chosen by C4C_PARAM_OPT_GROWTH.
+ */
+C4C_METHOD_INLINE(c4c_res_t, grow_, C4C_THIS vec, size_t required)
+{
+#ifdef C4C_ALLOC_STATIC
+	return required > vec->capacity ? C4CE_FULL : C4CE_SUCCESS;
+#else
+	size_t capacity;
+	if (required <= vec->capacity)
+		return C4CE_SUCCESS;
+	capacity = (size_t)C4C_PARAM_OPT_GROWTH(vec->capacity);
+	if (capacity < required)
+		capacity = required;
+	return C4C_METHOD_CALL(resize, vec, capacity);
+#endif
+}
+
+/*------------------------------------------------------------------------------
+    soa vector functions implementation
+------------------------------------------------------------------------------*/
+
+C4C_METHOD(c4c_res_t, init, C4C_THIS vec, size_t capacity)
+{
+#ifdef C4C_ALLOC_DYNAMIC
+	int failed = 0;
+#endif
+	vec->size = 0;
+#ifdef C4C_ALLOC_DYNAMIC
+	vec->capacity = capacity;
+	if (capacity == 0) {
+		C4C_PARAM_FIELDS(_soa_vector_null_)
+		return C4CE_INVALID_ARG;
+	}
+	C4C_PARAM_FIELDS(_soa_vector_alloc_)
+	if (failed) {
+		C4C_PARAM_FIELDS(_soa_vector_free_)
+		vec->capacity = 0;
+		return C4CE_MALLOC_FAIL;
+	}
+#else
+	vec->capacity = C4C_ALLOC_STATIC;
+#endif
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(void, free, C4C_THIS vec)
+{
+	vec->size = 0;
+	vec->capacity = 0;
+#ifdef C4C_ALLOC_STATIC
+	return;
+#else
+	C4C_PARAM_FIELDS(_soa_vector_free_)
+#endif
+}
+
+C4C_METHOD(c4c_res_t, resize, C4C_THIS vec, size_t capacity)
+{
+#ifdef C4C_ALLOC_STATIC
+	return C4CE_CANT_DO;
+#else
+	int failed = 0;
+	if (capacity == 0)
+		return C4CE_INVALID_ARG;
+	if (vec->capacity == capacity)
+		return C4CEW_NOTHING;
+	C4C_PARAM_FIELDS(_soa_vector_realloc_)
+	if (failed) {
+		/* The fields reallocated before the failure hold the new capacity, the
+		 * other ones the old capacity: only the smallest is usable. */
+		if (capacity < vec->capacity) {
+			vec->capacity = capacity;
+			if (vec->size > capacity)
+				vec->size = capacity;
+		}
+		return C4CE_REALLOC_FAIL;
+	}
+	vec->capacity = capacity;
+	if (vec->size > capacity) {
+		vec->size = capacity;
+		return C4CEW_ELEMS_DISCARDED;
+	}
+	return C4CE_SUCCESS;
+#endif
+}
+
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS vec, size_t capacity)
+{
+	if (capacity <= vec->capacity)
+		return C4CEW_NOTHING;
+#ifdef C4C_ALLOC_STATIC
+	return C4CE_CANT_DO;
+#else
+	return C4C_METHOD_CALL(resize, vec, capacity);
+#endif
+}
+
+C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec C4C_PARAM_FIELDS(_soa_vector_param_))
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + 1)))
+		return err;
+	C4C_PARAM_FIELDS(_soa_vector_store_)
+	++vec->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, pop_back, C4C_THIS vec)
+{
+	if (vec->size == 0)
+		return C4CE_EMPTY;
+	--vec->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, pop_at, C4C_THIS vec, size_t index)
+{
+	if (vec->size == 0)
+		return C4CE_EMPTY;
+	if (index >= vec->size)
+		return C4CE_INDEX_OUT_OF_BOUNDS;
+	C4C_PARAM_FIELDS(_soa_vector_take_last_)
+	--vec->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_PARAM_FIELDS(_soa_vector_accessor_)
+
+/* undef static functions macros */
+#undef _soa_vector_alloc_
+#undef _soa_vector_null_
+#undef _soa_vector_free_
+#undef _soa_vector_realloc_
+#undef _soa_vector_store_
+#undef _soa_vector_take_last_
+#undef _soa_vector_param_
+#undef _soa_vector_accessor_
+
+/*------------------------------------------------------------------------------
+	undef header params
+------------------------------------------------------------------------------*/
+
+#include "c4c/internal/common_headers_undef.h"
+
+#include "c4c/internal/params/default_undef.h"
+#include "c4c/internal/params/fields_undef.h"
+#include "c4c/internal/params/optgrowth_undef.h"
+
+#include "c4c/internal/allocators_undef.h"
@@ -43,12 +43,18 @@
  * - Random access by index.
  * - push/pop elements wherever you want to.
  * - Heap allocation/deallocation ONLY upon initialization and freeing (if dynamic).
- * - Resizable (if dynamic).
+ * - Resizable (if dynamic) with a customizable growth policy.
  * - Copyable (to another vector).
+ * - Bulk insertion of whole arrays with a single allocation and copy.
  * - Extremely fast elements insertion and deletion without any sort of memory
  *   management (as long as you are ok with having some elements shuffled every
  *   time you call such functions)
  * - The same element may not be at the same index forever (see point above).
+ * - Order preserving insertion and deletion (one block move each) when needed.
+ * - Order preserving bulk removal (remove_if/compact) in a single pass.
+ * - Sortable with an inlined comparison (introsort) or by integer key (radix).
+ * - SSE2/AVX2 accelerated find/count/min/max/sum for arithmetic content types.
+ * - Optionally aligned storage (cache line, SIMD registers, pages...).
  */
 
 #include "c4c/internal/allocators_decl.h"
@@ -64,10 +70,22 @@ Parameters:
 #define C4C_PARAM_STRUCT_NAME 
 #define C4C_PARAM_PREFIX 
 #define C4C_PARAM_CONTENT_TYPE 
+#define C4C_PARAM_OPT_GROWTH
+#define C4C_PARAM_OPT_TRIVIAL
+#define C4C_PARAM_OPT_COMPARE
+#define C4C_PARAM_OPT_RADIX_KEY
+#define C4C_PARAM_OPT_ARITHMETIC
+#define C4C_PARAM_OPT_ALIGNMENT
 */
 
 #include "c4c/internal/params/default.h"
 #include "c4c/internal/params/contenttype.h"
+#include "c4c/internal/params/optgrowth.h"
+#include "c4c/internal/params/opttrivial.h"
+#include "c4c/internal/params/optcompare.h"
+#include "c4c/internal/params/optradixkey.h"
+#include "c4c/internal/params/optarithmetic.h"
+#include "c4c/internal/params/optalignment.h"
 
 /*------------------------------------------------------------------------------
 	vector struct definition
@@ -76,7 +94,11 @@ Parameters:
 C4C_STRUCT_BEGIN(C4C_PARAM_STRUCT_NAME)
 	size_t size;
 	size_t capacity;
+#if C4C_PARAM_OPT_ALIGNMENT
+	C4C_RAW_ARRAY_ALIGNED(C4C_PARAM_CONTENT_TYPE, data, C4C_PARAM_OPT_ALIGNMENT);
+#else
 	C4C_RAW_ARRAY(C4C_PARAM_CONTENT_TYPE, data);
+#endif
 C4C_STRUCT_END(C4C_PARAM_STRUCT_NAME)
 
 /*------------------------------------------------------------------------------
@@ -110,7 +132,9 @@ C4C_METHOD(void, free, C4C_THIS vec);
  * @param vec       The vector.
  * @param capacity  The new capacity.
  *
- * @retval C4CE_REALLOC_FAIL      Memory reallocation failed.
+ * @retval C4CE_INVALID_ARG       Capacity is zero.
+ * @retval C4CE_REALLOC_FAIL      Memory reallocation failed. The vector is left
+ *                                untouched.
  * @retval C4CE_CANT_DO           C4C_ALLOC_STATIC is defined. Cannot resize a
  *                                static array.
  * @retval C4CE_SUCCESS           Success.
@@ -120,6 +144,34 @@ C4C_METHOD(void, free, C4C_THIS vec);
  */
 C4C_METHOD(c4c_res_t, resize, C4C_THIS vec, size_t capacity);
 
+/**
+ * Make sure the vector can hold at least the specified number of elements
+ * without further reallocations. Never shrinks the vector.
+ *
+ * @param vec       The vector.
+ * @param capacity  The minimum capacity.
+ *
+ * @retval C4CE_CANT_DO   C4C_ALLOC_STATIC is defined and capacity is greater
+ *                        than the static capacity.
+ * @retval resize()'s     error codes.
+ * @retval C4CE_SUCCESS   Success.
+ * @retval C4CEW_NOTHING  The vector can already hold capacity elements.
+ */
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS vec, size_t capacity);
+
+/**
+ * Release the unused capacity so that capacity == size (or 1 if the vector is
+ * empty).
+ *
+ * @param vec  The vector.
+ *
+ * @retval C4CE_CANT_DO   C4C_ALLOC_STATIC is defined.
+ * @retval resize()'s     error codes.
+ * @retval C4CE_SUCCESS   Success.
+ * @retval C4CEW_NOTHING  There is no unused capacity to release.
+ */
+C4C_METHOD(c4c_res_t, shrink_to_fit, C4C_THIS vec);
+
 /**
  * Copy the entire content of the first vector into the second one. Resize if
  * neccesary.
@@ -138,6 +190,8 @@ C4C_METHOD(c4c_res_t, copy, const C4C_THIS from, C4C_THIS to);
 /**
  * Insert a new element at the end of the vector (if not already full).
  *
+ * @note If the vector is full it will grow following C4C_PARAM_OPT_GROWTH.
+ *
  * @param vec      The vector.
  * @param element  The element to add.
  *
@@ -148,6 +202,20 @@ C4C_METHOD(c4c_res_t, copy, const C4C_THIS from, C4C_THIS to);
  */
 C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element);
 
+/**
+ * Insert a new uninitialized element at the end of the vector and return a
+ * pointer to it so that it can be constructed in place (no copies).
+ *
+ * @warning The pointer is invalidated by the next operation that grows the
+ *          vector.
+ *
+ * @param vec  The vector.
+ *
+ * @return The new element. NULL if the vector couldn't grow (or is full and
+ *         C4C_ALLOC_STATIC has been defined).
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, emplace_back, C4C_THIS vec);
+
 /**
  * Insert a new element at the specified index position.
  *
@@ -162,12 +230,106 @@ C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element);
  *
  * @retval C4CE_FULL                 The vector is full and can't be expanded
  *                                   (C4C_ALLOC_STATIC has been defined).
- * @retval C4CE_INDEX_OUT_OF_BOUNDS  Index is out of bounds.
+ * @retval C4CE_INDEX_OUT_OF_BOUNDS  Index is out of bounds (index > size).
  * @retval resize()'s                error codes.
  * @retval C4CE_SUCCESS              Success.
  */
 C4C_METHOD(c4c_res_t, push_at, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element, size_t index);
 
+/**
+ * Insert a new uninitialized element at the specified index position and return
+ * a pointer to it. Like push_at() the old element at the index position is
+ * moved to the end of the vector.
+ *
+ * @warning The pointer is invalidated by the next operation that grows the
+ *          vector.
+ *
+ * @param vec    The vector.
+ * @param index  Where to add the new element (index <= size).
+ *
+ * @return The new element. NULL if index is out of bounds or the vector
+ *         couldn't grow.
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, emplace_at, C4C_THIS vec, size_t index);
+
+/**
+ * Insert a new element at the specified index position preserving the order
+ * of the other elements.
+ *
+ * @note The elements starting at index are shifted one position forward (O(n)).
+ *       Use push_at() if the order doesn't matter.
+ *
+ * @param vec      The vector.
+ * @param element  The element to add.
+ * @param index    Where to add the new element (index <= size).
+ *
+ * @retval C4CE_FULL                 The vector is full and can't be expanded
+ *                                   (C4C_ALLOC_STATIC has been defined).
+ * @retval C4CE_INDEX_OUT_OF_BOUNDS  Index is out of bounds (index > size).
+ * @retval resize()'s                error codes.
+ * @retval C4CE_SUCCESS              Success.
+ */
+C4C_METHOD(c4c_res_t, insert_stable, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element, size_t index);
+
+/**
+ * Insert n elements at the end of the vector growing it (at most) once.
+ *
+ * @warning src must not point inside the vector itself.
+ *
+ * @param vec  The vector.
+ * @param src  The elements to add.
+ * @param n    The number of elements to add.
+ *
+ * @retval C4CE_FULL      The vector doesn't have enough room for n more
+ *                        elements and can't be expanded (C4C_ALLOC_STATIC has
+ *                        been defined).
+ * @retval resize()'s     error codes.
+ * @retval C4CE_SUCCESS   Success.
+ * @retval C4CEW_NOTHING  n is zero.
+ */
+C4C_METHOD(c4c_res_t, append_n, C4C_THIS vec, const C4C_PARAM_CONTENT_TYPE* src, size_t n);
+
+/**
+ * Insert n elements at the specified index position growing the vector (at
+ * most) once.
+ *
+ * @note Unlike push_at() the order of the elements is preserved: the elements
+ *       starting at index are shifted n positions forward.
+ *
+ * @warning src must not point inside the vector itself.
+ *
+ * @param vec    The vector.
+ * @param index  Where to add the first new element (index <= size).
+ * @param src    The elements to add.
+ * @param n      The number of elements to add.
+ *
+ * @retval C4CE_FULL                 The vector doesn't have enough room for n
+ *                                   more elements and can't be expanded
+ *                                   (C4C_ALLOC_STATIC has been defined).
+ * @retval C4CE_INDEX_OUT_OF_BOUNDS  Index is out of bounds (index > size).
+ * @retval resize()'s                error codes.
+ * @retval C4CE_SUCCESS              Success.
+ * @retval C4CEW_NOTHING             n is zero.
+ */
+C4C_METHOD(c4c_res_t, insert_range, C4C_THIS vec, size_t index, const C4C_PARAM_CONTENT_TYPE* src, size_t n);
+
+/**
+ * Replace the whole content of the vector with n elements.
+ *
+ * @warning src must not point inside the vector itself.
+ *
+ * @param vec  The vector.
+ * @param src  The new elements.
+ * @param n    The number of elements.
+ *
+ * @retval C4CE_FULL     n is greater than the vector's capacity and the vector
+ *                       can't be expanded (C4C_ALLOC_STATIC has been defined).
+ *                       The vector is left untouched.
+ * @retval resize()'s    error codes. The vector is left untouched.
+ * @retval C4CE_SUCCESS  Success.
+ */
+C4C_METHOD(c4c_res_t, assign, C4C_THIS vec, const C4C_PARAM_CONTENT_TYPE* src, size_t n);
+
 /**
  * Remove the last element of the vector.
  *
@@ -196,6 +358,196 @@ C4C_METHOD(c4c_res_t, pop_back, C4C_THIS vec);
  */
 C4C_METHOD(c4c_res_t, pop_at, C4C_THIS vec, size_t index);
 
+/**
+ * Remove the element at the specified index position preserving the order of
+ * the other elements.
+ *
+ * @note The elements following index are shifted one position backward (O(n)).
+ *       Use pop_at() if the order doesn't matter.
+ *
+ * @param vec    The vector.
+ * @param index  The position of the element to remove.
+ *
+ * @retval C4CE_EMPTY                The vector is already empty.
+ * @retval C4CE_INDEX_OUT_OF_BOUNDS  Index is out of bounds (index >= size).
+ * @retval C4CE_SUCCESS              Success.
+ */
+C4C_METHOD(c4c_res_t, erase_stable, C4C_THIS vec, size_t index);
+
+/**
+ * Remove the elements in the range [first, last) preserving the order of the
+ * other elements.
+ *
+ * @param vec    The vector.
+ * @param first  The position of the first element to remove.
+ * @param last   The position following the last element to remove.
+ *
+ * @retval C4CE_INVALID_ARG          first > last.
+ * @retval C4CE_INDEX_OUT_OF_BOUNDS  The range is out of bounds (last > size).
+ * @retval C4CE_SUCCESS              Success.
+ * @retval C4CEW_NOTHING             The range is empty (first == last).
+ */
+C4C_METHOD(c4c_res_t, erase_range, C4C_THIS vec, size_t first, size_t last);
+
+/**
+ * Remove every element whose flag in mask is not zero preserving the order of
+ * the other elements.
+ *
+ * @note Single forward pass with branchless writes: much faster than calling
+ *       pop_at()/erase_stable() in a loop when many elements go away at once.
+ *
+ * @param vec   The vector.
+ * @param mask  One flag per element (at least size flags).
+ *
+ * @return The number of removed elements.
+ */
+C4C_METHOD(size_t, compact, C4C_THIS vec, const unsigned char* mask);
+
+/**
+ * Get the last element of the vector.
+ *
+ * @param vec  The vector.
+ *
+ * @return The last element. NULL if the vector is empty.
+ */
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, back, C4C_THIS vec);
+
+#ifndef c4c_vector_remove_if
+/**
+ * Remove every element of a vector satisfying a predicate preserving the order
+ * of the other elements (see compact()).
+ *
+ * @param vec      The vector.
+ * @param pos      The element pointer to use as a loop counter.
+ * @param pred     The predicate, an expression of pos. Evaluated once per
+ *                 element in order.
+ * @param removed  A size_t lvalue receiving the number of removed elements.
+ */
+#define c4c_vector_remove_if(vec, pos, pred, removed) \
+	do { \
+		size_t c4c_i_, c4c_kept_ = 0; \
+		int c4c_keep_; \
+		for (c4c_i_ = 0; c4c_i_ < (vec)->size; ++c4c_i_) { \
+			pos = (vec)->data + c4c_i_; \
+			c4c_keep_ = !(pred); \
+			(vec)->data[c4c_kept_] = *pos; \
+			c4c_kept_ += (size_t)c4c_keep_; \
+		} \
+		(removed) = (vec)->size - c4c_kept_; \
+		(vec)->size = c4c_kept_; \
+	} while (0)
+#endif
+
+#ifdef C4C_PARAM_OPT_COMPARE
+/**
+ * Sort the vector in place (introsort: O(n log n) worst case, not stable).
+ *
+ * @note Only available if C4C_PARAM_OPT_COMPARE has been defined. The macro
+ *       receives two elements (by value).
+ *
+ * @param vec  The vector.
+ */
+C4C_METHOD(void, sort, C4C_THIS vec);
+#endif
+
+#ifdef C4C_PARAM_OPT_RADIX_KEY
+/**
+ * Sort the vector in ascending key order with an LSD radix sort (O(n * key
+ * bytes), stable). Byte positions shared by every key are skipped.
+ *
+ * @note Only available if C4C_PARAM_OPT_RADIX_KEY has been defined.
+ * @note Allocates a temporary buffer of size elements (even if
+ *       C4C_ALLOC_STATIC has been defined).
+ *
+ * @param vec  The vector.
+ *
+ * @retval C4CE_MALLOC_FAIL  C4C_ALLOC() failed. The vector is left untouched.
+ * @retval C4CE_SUCCESS      Success.
+ * @retval C4CEW_NOTHING     The vector has less than two elements.
+ */
+C4C_METHOD(c4c_res_t, radix_sort, C4C_THIS vec);
+#endif
+
+#ifdef C4C_PARAM_OPT_ARITHMETIC
+/**
+ * Find the first element equal to value.
+ *
+ * @note Only available if C4C_PARAM_OPT_ARITHMETIC has been defined. Uses
+ *       SSE2/AVX2 when available (see c4c/internal/simd.inl).
+ *
+ * @param vec    The vector.
+ * @param value  The value to look for.
+ *
+ * @return The element's index. size if not found.
+ */
+C4C_METHOD(size_t, find, const C4C_THIS vec, C4C_PARAM_CONTENT_TYPE value);
+
+/**
+ * Count the elements equal to value.
+ *
+ * @note Only available if C4C_PARAM_OPT_ARITHMETIC has been defined.
+ *
+ * @param vec    The vector.
+ * @param value  The value to count.
+ *
+ * @return The number of occurrences.
+ */
+C4C_METHOD(size_t, count, const C4C_THIS vec, C4C_PARAM_CONTENT_TYPE value);
+
+/**
+ * Test whether the vector contains value.
+ *
+ * @note Only available if C4C_PARAM_OPT_ARITHMETIC has been defined.
+ *
+ * @param vec    The vector.
+ * @param value  The value to look for.
+ *
+ * @return 1 if found. 0 otherwise.
+ */
+C4C_METHOD(int, contains, const C4C_THIS vec, C4C_PARAM_CONTENT_TYPE value);
+
+/**
+ * Get the smallest element.
+ *
+ * @note Only available if C4C_PARAM_OPT_ARITHMETIC has been defined. The
+ *       result is unspecified if the vector contains NaNs.
+ *
+ * @param vec  The vector.
+ * @param min  Receives the smallest element.
+ *
+ * @retval C4CE_EMPTY    The vector is empty. min is left untouched.
+ * @retval C4CE_SUCCESS  Success.
+ */
+C4C_METHOD(c4c_res_t, min, const C4C_THIS vec, C4C_PARAM_CONTENT_TYPE* min);
+
+/**
+ * Get the greatest element.
+ *
+ * @note Only available if C4C_PARAM_OPT_ARITHMETIC has been defined. The
+ *       result is unspecified if the vector contains NaNs.
+ *
+ * @param vec  The vector.
+ * @param max  Receives the greatest element.
+ *
+ * @retval C4CE_EMPTY    The vector is empty. max is left untouched.
+ * @retval C4CE_SUCCESS  Success.
+ */
+C4C_METHOD(c4c_res_t, max, const C4C_THIS vec, C4C_PARAM_CONTENT_TYPE* max);
+
+/**
+ * Sum every element.
+ *
+ * @note Only available if C4C_PARAM_OPT_ARITHMETIC has been defined.
+ *       Integers are summed as 64 bit integers (wrapping on overflow), floats
+ *       and doubles as doubles in an unspecified order.
+ *
+ * @param vec  The vector.
+ *
+ * @return The sum (0 if the vector is empty).
+ */
+C4C_METHOD(__C4C_ARITH_SUM_TYPE, sum, const C4C_THIS vec);
+#endif
+
 /*------------------------------------------------------------------------------
 	undef header params
 ------------------------------------------------------------------------------*/
@@ -204,5 +556,11 @@ C4C_METHOD(c4c_res_t, pop_at, C4C_THIS vec, size_t index);
 
 #include "c4c/internal/params/default_undef.h"
 #include "c4c/internal/params/contenttype_undef.h"
+#include "c4c/internal/params/optgrowth_undef.h"
+#include "c4c/internal/params/opttrivial_undef.h"
+#include "c4c/internal/params/optcompare_undef.h"
+#include "c4c/internal/params/optradixkey_undef.h"
+#include "c4c/internal/params/optarithmetic_undef.h"
+#include "c4c/internal/params/optalignment_undef.h"
 
 #include "c4c/internal/allocators_undef.h"
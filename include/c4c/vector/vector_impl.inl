@@ -29,12 +29,100 @@
 #include "c4c/internal/allocators_impl.h"
 #include "c4c/internal/common_headers.h"
 
+#include <string.h> /* for memcpy(), memmove(), memset() */
+
 /*------------------------------------------------------------------------------
 	params
 ------------------------------------------------------------------------------*/
 
 #include "c4c/internal/params/default.h"
 #include "c4c/internal/params/contenttype.h"
+#include "c4c/internal/params/optgrowth.h"
+#include "c4c/internal/params/opttrivial.h"
+#include "c4c/internal/params/optcompare.h"
+#include "c4c/internal/params/optradixkey.h"
+#include "c4c/internal/params/optarithmetic.h"
+#include "c4c/internal/params/optalignment.h"
+
+/*------------------------------------------------------------------------------
+    vector static functions
+------------------------------------------------------------------------------*/
+
+#if C4C_PARAM_OPT_TRIVIAL
+
+/*
+ * Copy n elements between two non overlapping blocks.
+ */
+#define _vector_copy_(dst, src, n) \
+	memcpy((dst), (src), sizeof(C4C_PARAM_CONTENT_TYPE) * (n))
+
+/*
+ * Copy n elements between two (possibly) overlapping blocks.
+ */
+#define _vector_move_(dst, src, n) \
+	memmove((dst), (src), sizeof(C4C_PARAM_CONTENT_TYPE) * (n))
+
+#else
+
+#define _vector_copy_(dst, src, n) \
+	do { \
+		size_t __i; \
+		for (__i = 0; __i < (n); ++__i) \
+			(dst)[__i] = (src)[__i]; \
+	} while (0)
+
+#define _vector_move_(dst, src, n) \
+	do { \
+		size_t __i; \
+		if ((dst) < (src)) { \
+			for (__i = 0; __i < (n); ++__i) \
+				(dst)[__i] = (src)[__i]; \
+		} else { \
+			for (__i = (n); __i > 0; --__i) \
+				(dst)[__i - 1] = (src)[__i - 1]; \
+		} \
+	} while (0)
+
+#endif /* C4C_PARAM_OPT_TRIVIAL */
+
+#if C4C_PARAM_OPT_ALIGNMENT
+#  define _vector_alloc_(size) C4C_ALIGNED_ALLOC(C4C_PARAM_OPT_ALIGNMENT, size)
+#  define _vector_free_(ptr) C4C_ALIGNED_FREE(ptr)
+#else
+#  define _vector_alloc_(size) C4C_ALLOC(size)
+#  define _vector_free_(ptr) C4C_FREE(ptr)
+#endif
+
+/*
+ * Make sure there is room for at least 'required' elements. If the vector has
+ * to grow, the new capacity is chosen by C4C_PARAM_OPT_GROWTH.
+ */
+C4C_METHOD_INLINE(c4c_res_t, grow_, C4C_THIS vec, size_t required)
+{
+#ifdef C4C_ALLOC_STATIC
+	return required > vec->capacity ? C4CE_FULL : C4CE_SUCCESS;
+#else
+	size_t capacity;
+	if (required <= vec->capacity)
+		return C4CE_SUCCESS;
+	capacity = (size_t)C4C_PARAM_OPT_GROWTH(vec->capacity);
+	if (capacity < required)
+		capacity = required;
+	return C4C_METHOD_CALL(resize, vec, capacity);
+#endif
+}
+
+#ifdef C4C_PARAM_OPT_COMPARE
+#  define __C4C_SORT_TYPE C4C_PARAM_CONTENT_TYPE
+#  define __C4C_SORT_LESS C4C_PARAM_OPT_COMPARE
+#  include "c4c/internal/introsort.inl"
+#endif
+
+#ifdef C4C_PARAM_OPT_ARITHMETIC
+#  define __C4C_SIMD_TYPE C4C_PARAM_CONTENT_TYPE
+#  define __C4C_SIMD_KIND C4C_PARAM_OPT_ARITHMETIC
+#  include "c4c/internal/simd.inl"
+#endif
 
 /*------------------------------------------------------------------------------
     vector functions implementation
@@ -49,7 +137,7 @@ C4C_METHOD(c4c_res_t, init, C4C_THIS vec, size_t capacity)
 		vec->data = NULL;
 		return C4CE_INVALID_ARG;
 	}
-	vec->data = C4C_ALLOC(sizeof(C4C_PARAM_CONTENT_TYPE) * capacity);
+	vec->data = _vector_alloc_(sizeof(C4C_PARAM_CONTENT_TYPE) * capacity);
 	if (!vec->data) {
 		vec->capacity = 0;
 		return C4CE_MALLOC_FAIL;
@@ -67,7 +155,7 @@ C4C_METHOD(void, free, C4C_THIS vec)
 #ifdef C4C_ALLOC_STATIC
 	return;
 #else
-	C4C_FREE(vec->data);
+	_vector_free_(vec->data);
 	vec->data = NULL;
 #endif
 }
@@ -77,14 +165,27 @@ C4C_METHOD(c4c_res_t, resize, C4C_THIS vec, size_t capacity)
 #ifdef C4C_ALLOC_STATIC
 	return C4CE_CANT_DO;
 #else
-	size_t old_capacity = vec->capacity;
+	C4C_PARAM_CONTENT_TYPE* data;
+	if (capacity == 0)
+		return C4CE_INVALID_ARG;
 	if (vec->capacity == capacity)
 		return C4CEW_NOTHING;
-	vec->data = C4C_REALLOC(vec->data, sizeof(C4C_PARAM_CONTENT_TYPE) * capacity);
-	if (!vec->data)
+#if C4C_PARAM_OPT_ALIGNMENT
+	/* There's no aligned realloc: move the live elements by hand. */
+	data = _vector_alloc_(sizeof(C4C_PARAM_CONTENT_TYPE) * capacity);
+	if (!data)
 		return C4CE_REALLOC_FAIL;
+	if (vec->size != 0)
+		_vector_copy_(data, vec->data, vec->size < capacity ? vec->size : capacity);
+	_vector_free_(vec->data);
+#else
+	data = C4C_REALLOC(vec->data, sizeof(C4C_PARAM_CONTENT_TYPE) * capacity);
+	if (!data)
+		return C4CE_REALLOC_FAIL;
+#endif
+	vec->data = data;
 	vec->capacity = capacity;
-	if (old_capacity > capacity) {
+	if (vec->size > capacity) {
 		vec->size = capacity;
 		return C4CEW_ELEMS_DISCARDED;
 	}
@@ -92,20 +193,38 @@ C4C_METHOD(c4c_res_t, resize, C4C_THIS vec, size_t capacity)
 #endif
 }
 
+C4C_METHOD(c4c_res_t, reserve, C4C_THIS vec, size_t capacity)
+{
+	if (capacity <= vec->capacity)
+		return C4CEW_NOTHING;
+#ifdef C4C_ALLOC_STATIC
+	return C4CE_CANT_DO;
+#else
+	return C4C_METHOD_CALL(resize, vec, capacity);
+#endif
+}
+
+C4C_METHOD(c4c_res_t, shrink_to_fit, C4C_THIS vec)
+{
+#ifdef C4C_ALLOC_STATIC
+	return C4CE_CANT_DO;
+#else
+	return C4C_METHOD_CALL(resize, vec, vec->size > 0 ? vec->size : 1);
+#endif
+}
+
 C4C_METHOD(c4c_res_t, copy, const C4C_THIS from, C4C_THIS to)
 {
 	c4c_res_t err = C4CE_SUCCESS;
-	size_t i;
+	if (from == to)
+		return C4CE_SUCCESS;
 #ifdef C4C_ALLOC_DYNAMIC
-	if (from->size >= to->capacity) {
-		err = C4C_METHOD_CALL(resize, to, from->size);
-		if (!c4c_succeeded(err))
-			return err;
-	}
+	err = C4C_METHOD_CALL(reserve, to, from->size);
+	if (!c4c_succeeded(err))
+		return err;
 #endif
-	for (i = 0; i < from->size; ++i) {
-		to->data[i] = from->data[i];
-	}
+	if (from->size != 0)
+		_vector_copy_(to->data, from->data, from->size);
 	to->size = from->size;
 	return C4CE_SUCCESS;
 }
@@ -113,30 +232,28 @@ C4C_METHOD(c4c_res_t, copy, const C4C_THIS from, C4C_THIS to)
 C4C_METHOD(c4c_res_t, push_back, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element)
 {
 	c4c_res_t err = C4CE_SUCCESS;
-	if (vec->size >= vec->capacity)
-#ifdef C4C_ALLOC_STATIC
-		return C4CE_FULL;
-#else
-		if (!c4c_succeeded(err = C4C_METHOD_CALL(resize, vec, vec->capacity + C4C_ALLOC_DYNAMIC)))
-			return err;
-#endif
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + 1)))
+		return err;
 	vec->data[vec->size] = element;
 	++vec->size;
 	return C4CE_SUCCESS;
 }
 
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, emplace_back, C4C_THIS vec)
+{
+	if (!c4c_succeeded(C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + 1)))
+		return NULL;
+	++vec->size;
+	return vec->data + (vec->size - 1);
+}
+
 C4C_METHOD(c4c_res_t, push_at, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element, size_t index)
 {
 	c4c_res_t err = C4CE_SUCCESS;
-	if (index >= vec->capacity)
+	if (index > vec->size)
 		return C4CE_INDEX_OUT_OF_BOUNDS;
-	if (vec->size >= vec->capacity)
-#ifdef C4C_ALLOC_STATIC
-		return C4CE_FULL;
-#else
-		if (!c4c_succeeded(err = C4C_METHOD_CALL(resize, vec, vec->capacity + C4C_ALLOC_DYNAMIC)))
-			return err;
-#endif
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + 1)))
+		return err;
 	/* Move the element at the specified index to the new last place the insert
 	 * the new element in the right spot. */
 	vec->data[vec->size] = vec->data[index];
@@ -145,6 +262,69 @@ C4C_METHOD(c4c_res_t, push_at, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element, siz
 	return C4CE_SUCCESS;
 }
 
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, emplace_at, C4C_THIS vec, size_t index)
+{
+	if (index > vec->size)
+		return NULL;
+	if (!c4c_succeeded(C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + 1)))
+		return NULL;
+	vec->data[vec->size] = vec->data[index];
+	++vec->size;
+	return vec->data + index;
+}
+
+C4C_METHOD(c4c_res_t, insert_stable, C4C_THIS vec, C4C_PARAM_CONTENT_TYPE element, size_t index)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (index > vec->size)
+		return C4CE_INDEX_OUT_OF_BOUNDS;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + 1)))
+		return err;
+	_vector_move_(vec->data + index + 1, vec->data + index, vec->size - index);
+	vec->data[index] = element;
+	++vec->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, append_n, C4C_THIS vec, const C4C_PARAM_CONTENT_TYPE* src, size_t n)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (n == 0)
+		return C4CEW_NOTHING;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + n)))
+		return err;
+	_vector_copy_(vec->data + vec->size, src, n);
+	vec->size += n;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, insert_range, C4C_THIS vec, size_t index, const C4C_PARAM_CONTENT_TYPE* src, size_t n)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (index > vec->size)
+		return C4CE_INDEX_OUT_OF_BOUNDS;
+	if (n == 0)
+		return C4CEW_NOTHING;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, vec->size + n)))
+		return err;
+	/* Open a gap of n elements at index then fill it. */
+	_vector_move_(vec->data + index + n, vec->data + index, vec->size - index);
+	_vector_copy_(vec->data + index, src, n);
+	vec->size += n;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, assign, C4C_THIS vec, const C4C_PARAM_CONTENT_TYPE* src, size_t n)
+{
+	c4c_res_t err = C4CE_SUCCESS;
+	if (!c4c_succeeded(err = C4C_METHOD_INLINE_CALL(grow_, vec, n)))
+		return err;
+	if (n != 0)
+		_vector_copy_(vec->data, src, n);
+	vec->size = n;
+	return C4CE_SUCCESS;
+}
+
 C4C_METHOD(c4c_res_t, pop_back, C4C_THIS vec)
 {
 	if (vec->size == 0)
@@ -165,6 +345,143 @@ C4C_METHOD(c4c_res_t, pop_at, C4C_THIS vec, size_t index)
 	return C4CE_SUCCESS;
 }
 
+C4C_METHOD(c4c_res_t, erase_stable, C4C_THIS vec, size_t index)
+{
+	if (vec->size == 0)
+		return C4CE_EMPTY;
+	if (index >= vec->size)
+		return C4CE_INDEX_OUT_OF_BOUNDS;
+	_vector_move_(vec->data + index, vec->data + index + 1, vec->size - index - 1);
+	--vec->size;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, erase_range, C4C_THIS vec, size_t first, size_t last)
+{
+	if (first > last)
+		return C4CE_INVALID_ARG;
+	if (last > vec->size)
+		return C4CE_INDEX_OUT_OF_BOUNDS;
+	if (first == last)
+		return C4CEW_NOTHING;
+	_vector_move_(vec->data + first, vec->data + last, vec->size - last);
+	vec->size -= last - first;
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(size_t, compact, C4C_THIS vec, const unsigned char* mask)
+{
+	size_t i, kept = 0, removed;
+	/* Unconditional write, the destination index only advances for kept
+	 * elements (kept <= i so nothing still unread is overwritten). */
+	for (i = 0; i < vec->size; ++i) {
+		vec->data[kept] = vec->data[i];
+		kept += (size_t)(mask[i] == 0);
+	}
+	removed = vec->size - kept;
+	vec->size = kept;
+	return removed;
+}
+
+C4C_METHOD(C4C_PARAM_CONTENT_TYPE*, back, C4C_THIS vec)
+{
+	return vec->size != 0 ? vec->data + (vec->size - 1) : NULL;
+}
+
+#ifdef C4C_PARAM_OPT_COMPARE
+C4C_METHOD(void, sort, C4C_THIS vec)
+{
+	C4C_METHOD_INLINE_CALL(introsort_, vec->data, vec->size);
+}
+#endif
+
+#ifdef C4C_PARAM_OPT_RADIX_KEY
+C4C_METHOD(c4c_res_t, radix_sort, C4C_THIS vec)
+{
+	size_t counts[sizeof(C4C_PARAM_OPT_RADIX_KEY(vec->data[0]))][256];
+	size_t i, pass, sum, tmp;
+	C4C_PARAM_CONTENT_TYPE* src = vec->data;
+	C4C_PARAM_CONTENT_TYPE* dst;
+	C4C_PARAM_CONTENT_TYPE* swap;
+	C4C_PARAM_CONTENT_TYPE* buffer;
+	if (vec->size < 2)
+		return C4CEW_NOTHING;
+	buffer = C4C_ALLOC(sizeof(C4C_PARAM_CONTENT_TYPE) * vec->size);
+	if (!buffer)
+		return C4CE_MALLOC_FAIL;
+	dst = buffer;
+	/* Build the histograms of every byte position in a single read pass. */
+	memset(counts, 0, sizeof(counts));
+	for (i = 0; i < vec->size; ++i) {
+		for (pass = 0; pass < sizeof(counts) / sizeof(counts[0]); ++pass)
+			++counts[pass][(C4C_PARAM_OPT_RADIX_KEY(src[i]) >> (pass * 8)) & 0xFF];
+	}
+	for (pass = 0; pass < sizeof(counts) / sizeof(counts[0]); ++pass) {
+		/* Every key has the same byte here: nothing to do. */
+		if (counts[pass][(C4C_PARAM_OPT_RADIX_KEY(src[0]) >> (pass * 8)) & 0xFF] == vec->size)
+			continue;
+		for (i = 0, sum = 0; i < 256; ++i) {
+			tmp = counts[pass][i];
+			counts[pass][i] = sum;
+			sum += tmp;
+		}
+		for (i = 0; i < vec->size; ++i)
+			dst[counts[pass][(C4C_PARAM_OPT_RADIX_KEY(src[i]) >> (pass * 8)) & 0xFF]++] = src[i];
+		swap = src;
+		src = dst;
+		dst = swap;
+	}
+	if (src != vec->data)
+		_vector_copy_(vec->data, src, vec->size);
+	C4C_FREE(buffer);
+	return C4CE_SUCCESS;
+}
+#endif
+
+#ifdef C4C_PARAM_OPT_ARITHMETIC
+C4C_METHOD(size_t, find, const C4C_THIS vec, C4C_PARAM_CONTENT_TYPE value)
+{
+	return C4C_METHOD_INLINE_CALL(simd_find_, vec->data, vec->size, value);
+}
+
+C4C_METHOD(size_t, count, const C4C_THIS vec, C4C_PARAM_CONTENT_TYPE value)
+{
+	return C4C_METHOD_INLINE_CALL(simd_count_, vec->data, vec->size, value);
+}
+
+C4C_METHOD(int, contains, const C4C_THIS vec, C4C_PARAM_CONTENT_TYPE value)
+{
+	return C4C_METHOD_INLINE_CALL(simd_find_, vec->data, vec->size, value) != vec->size;
+}
+
+C4C_METHOD(c4c_res_t, min, const C4C_THIS vec, C4C_PARAM_CONTENT_TYPE* min)
+{
+	if (vec->size == 0)
+		return C4CE_EMPTY;
+	*min = C4C_METHOD_INLINE_CALL(simd_min_, vec->data, vec->size);
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(c4c_res_t, max, const C4C_THIS vec, C4C_PARAM_CONTENT_TYPE* max)
+{
+	if (vec->size == 0)
+		return C4CE_EMPTY;
+	*max = C4C_METHOD_INLINE_CALL(simd_max_, vec->data, vec->size);
+	return C4CE_SUCCESS;
+}
+
+C4C_METHOD(__C4C_ARITH_SUM_TYPE, sum, const C4C_THIS vec)
+{
+	return (__C4C_ARITH_SUM_TYPE)C4C_METHOD_INLINE_CALL(simd_sum_, vec->data, vec->size);
+}
+#endif
+
+/* undef static functions macros */
+#undef _vector_copy_
+#undef _vector_move_
+#undef _vector_alloc_
+#undef _vector_free_
+
 /*------------------------------------------------------------------------------
 	undef header params
 ------------------------------------------------------------------------------*/
@@ -173,5 +490,11 @@ C4C_METHOD(c4c_res_t, pop_at, C4C_THIS vec, size_t index)
 
 #include "c4c/internal/params/default_undef.h"
 #include "c4c/internal/params/contenttype_undef.h"
+#include "c4c/internal/params/optgrowth_undef.h"
+#include "c4c/internal/params/opttrivial_undef.h"
+#include "c4c/internal/params/optcompare_undef.h"
+#include "c4c/internal/params/optradixkey_undef.h"
+#include "c4c/internal/params/optarithmetic_undef.h"
+#include "c4c/internal/params/optalignment_undef.h"
 
 #include "c4c/internal/allocators_undef.h"